@@ -15,6 +15,8 @@
 
 #include "Wt/Chart/WChartGlobal.h"
 
+#include <vector>
+
 namespace Wt {
   namespace Chart {
 
@@ -41,6 +43,19 @@ public:
    */
   virtual double data(int row, int column) const = 0;
 
+  /*! \brief Returns data for a number of rows of a column.
+   *
+   * Reads the data() of the \p count rows starting at \p row, in the
+   * given \p column, into \p result, which is resized to \p count.
+   *
+   * The charts read the values of a data series with this method.
+   * The default implementation calls data() for every row. You may
+   * want to reimplement this method if your model can provide the
+   * data more efficiently in bulk.
+   */
+  virtual void dataRange(int row, int column, int count,
+                         std::vector<double>& result) const;
+
   /*! \brief Returns display data at a given row and column.
    *
    * This value should be a textual representation of the
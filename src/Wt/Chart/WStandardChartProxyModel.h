@@ -46,6 +46,17 @@ public:
    */
   virtual double data(int row, int column) const override;
 
+  /*! \brief Returns data for a number of rows of a column.
+   *
+   * Reads the \link ItemDataRole ItemDataRole::Display\endlink data
+   * of the rows in one call to WAbstractItemModel::dataRange(), and
+   * converts it to doubles.
+   *
+   * \sa WAbstractItemModel::dataRange()
+   */
+  virtual void dataRange(int row, int column, int count,
+                         std::vector<double>& result) const override;
+
   /*! \brief Returns display data at a given row and column.
    *
    * Returns the result of WAbstractItemModel::data() for the given
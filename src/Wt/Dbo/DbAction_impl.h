@@ -228,7 +228,7 @@ void DboAction::actWeakPtr(const WeakPtrRef<C>& field)
     int statementIdx = Session::FirstSqlSelectSet + setStatementIdx_;
 
     const std::string& sql
-      = dbo_->session()->getStatementSql(mapping_->tableName, statementIdx);
+      = dbo_->session()->getStatementSql(mapping_, statementIdx);
 
     field.value().setRelationData(dbo_, &sql, setInfo);
   } else
@@ -246,7 +246,7 @@ void DboAction::actCollection(const CollectionRef<C>& field)
     int statementIdx = Session::FirstSqlSelectSet + setStatementIdx_;
 
     const std::string& sql
-      = dbo_->session()->getStatementSql(mapping_->tableName, statementIdx);
+      = dbo_->session()->getStatementSql(mapping_, statementIdx);
 
     field.value().setRelationData(dbo_, &sql, setInfo);
   } else
@@ -440,7 +440,7 @@ void SaveBaseAction::actCollection(const CollectionRef<C>& field)
 
         SqlStatement *statement;
 
-        statement = session()->getStatement(mapping().tableName, statementIdx);
+        statement = session()->getStatement(&mapping(), statementIdx);
         {
           ScopedStatementUse use(statement);
 
@@ -467,7 +467,7 @@ void SaveBaseAction::actCollection(const CollectionRef<C>& field)
         // Sql delete
         ++statementIdx;
 
-        statement = session()->getStatement(mapping().tableName, statementIdx);
+        statement = session()->getStatement(&mapping(), statementIdx);
 
         {
           ScopedStatementUse use(statement);
@@ -0,0 +1,194 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_DBO_ELASTIC_SQL_CONNECTION_POOL_H_
+#define WT_DBO_ELASTIC_SQL_CONNECTION_POOL_H_
+
+#include <Wt/Dbo/SqlConnectionPool.h>
+
+#include <chrono>
+#include <string>
+
+namespace Wt {
+  namespace Dbo {
+
+/*! \class ElasticSqlConnectionPool Wt/Dbo/ElasticSqlConnectionPool.h Wt/Dbo/ElasticSqlConnectionPool.h
+ *  \brief A connection pool that grows and shrinks with demand.
+ *
+ * This connection pool keeps at least minSize() connections open, and
+ * opens additional connections, up to maxSize(), when no free
+ * connection is available. Connections that have been idle for longer
+ * than the idleTimeout() are closed again, as long as at least
+ * minSize() connections remain.
+ *
+ * New connections are cloned from the connection that is passed to
+ * the constructor. That connection is only used as a prototype and is
+ * never handed out to a session.
+ *
+ * Optionally, a connection that has been idle for a while is
+ * validated before it is handed out, by executing a validation query
+ * (see setValidationQuery()). If this fails, the connection is closed
+ * and replaced with a newly cloned connection.
+ *
+ * The pool keeps metrics (see metrics()) on how long sessions had to
+ * wait for a connection and how many connections are in use, which may
+ * help to size the pool.
+ *
+ * \sa FixedSqlConnectionPool
+ *
+ * \ingroup dbo
+ */
+class WTDBO_API ElasticSqlConnectionPool : public SqlConnectionPool
+{
+public:
+  /*! \brief Connection pool metrics.
+   *
+   * \sa metrics()
+   */
+  struct Metrics {
+    long long borrowCount;     //!< Number of connections handed out
+    long long waitCount;       //!< Number of times a session had to wait
+    long long timeoutCount;    //!< Number of times waiting timed out
+    std::chrono::steady_clock::duration totalWaitTime; //!< Total time waited
+    std::chrono::steady_clock::duration maxWaitTime; //!< Longest wait
+    long long createdCount;    //!< Number of connections opened
+    long long closedCount;     //!< Number of connections closed
+    long long validationFailureCount; //!< Number of failed validations
+    int inUse;                 //!< Connections currently in use
+    int maxInUse;              //!< Largest number of connections in use
+    int idle;                  //!< Connections currently free
+
+    Metrics();
+  };
+
+  /*! \brief Creates an elastic connection pool.
+   *
+   * The provided \p connection is used as a prototype, which is
+   * cloned \p minSize times to initialize the pool. The pool grows
+   * up to \p maxSize connections.
+   */
+  ElasticSqlConnectionPool(std::unique_ptr<SqlConnection> connection,
+                           int minSize, int maxSize);
+
+  virtual ~ElasticSqlConnectionPool();
+
+  /*! \brief Returns the minimum number of connections.
+   */
+  int minSize() const;
+
+  /*! \brief Returns the maximum number of connections.
+   */
+  int maxSize() const;
+
+  /*! \brief Returns the number of connections in the pool.
+   *
+   * This includes the connections that are currently in use, but not
+   * the prototype connection.
+   */
+  int size() const;
+
+  //! Get the total number of free connections available
+  int freeConnections() const;
+
+  /*! \brief Set a timeout to get a connection.
+   *
+   * When the pool has grown to maxSize() and has no available
+   * connection, it will wait the given duration.
+   *
+   * On timeout, handleTimeout() is called, which throws an exception
+   * by default.
+   *
+   * By default, there is no timeout.
+   */
+  void setTimeout(std::chrono::steady_clock::duration timeout);
+
+  /*! \brief Get the timeout to get a connection.
+   *
+   * \sa setTimeout()
+   */
+  std::chrono::steady_clock::duration timeout() const;
+
+  /*! \brief Sets the idle timeout.
+   *
+   * Free connections that have not been used for this duration are
+   * closed, while keeping at least minSize() connections.
+   *
+   * The default idle timeout is 5 minutes. A zero duration disables
+   * closing idle connections.
+   */
+  void setIdleTimeout(std::chrono::steady_clock::duration timeout);
+
+  /*! \brief Returns the idle timeout.
+   *
+   * \sa setIdleTimeout()
+   */
+  std::chrono::steady_clock::duration idleTimeout() const;
+
+  /*! \brief Configures validation of connections.
+   *
+   * When a connection has been idle for at least \p interval, the
+   * \p sql statement is executed on it before it is handed out (e.g.
+   * <tt>"select 1"</tt>). When this fails, the connection is replaced
+   * with a new one.
+   *
+   * By default, the validation query is empty, and connections are
+   * not validated.
+   *
+   * \sa validate()
+   */
+  void setValidationQuery(const std::string& sql,
+                          std::chrono::steady_clock::duration interval
+                            = std::chrono::seconds(30));
+
+  /*! \brief Returns the validation query.
+   *
+   * \sa setValidationQuery()
+   */
+  std::string validationQuery() const;
+
+  /*! \brief Returns the metrics.
+   */
+  Metrics metrics() const;
+
+  /*! \brief Resets the counters of the metrics.
+   *
+   * This resets the counters, but not the current number of
+   * connections in use or idle.
+   */
+  void resetMetrics();
+
+  virtual std::unique_ptr<SqlConnection> getConnection() override;
+  virtual void returnConnection(std::unique_ptr<SqlConnection>) override;
+  virtual void prepareForDropTables() const override;
+
+protected:
+  /*! \brief Handle a timeout that occured while getting a connection.
+   *
+   * The default implementation throws an Exception.
+   *
+   * If the function returns cleanly, another attempt is made to obtain
+   * a connection.
+   */
+  virtual void handleTimeout();
+
+  /*! \brief Validates a connection.
+   *
+   * The default implementation executes the validationQuery(), and
+   * returns \c false if this throws an exception.
+   */
+  virtual bool validate(SqlConnection& connection);
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+
+  std::unique_ptr<SqlConnection> createConnection();
+};
+
+  }
+}
+
+#endif // WT_DBO_ELASTIC_SQL_CONNECTION_POOL_H_
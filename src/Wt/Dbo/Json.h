@@ -216,10 +216,44 @@ public:
       session_ = NULL;
     }
 
+    /*! \brief Starts an array that is serialized element by element.
+     *
+     * This may be used to stream a large result, serializing each
+     * element with serializeElement() as it is fetched from the
+     * database, instead of collecting all results in a std::vector
+     * or \ref collection first. The array is closed with endArray().
+     *
+     * When \p continued is \c true, the array was started by another
+     * serializer, e.g. for an earlier chunk of a response that is sent
+     * in several parts: no opening bracket is written, and the first
+     * element is preceded by a comma.
+     *
+     * \sa JsonQueryResource
+     */
+    void beginArray(bool continued = false);
+
+    /*! \brief Serialize an element of an array.
+     *
+     * \sa beginArray()
+     */
+    template<typename T>
+    void serializeElement(const T& t) {
+      if (!firstElement_)
+        out(',');
+      firstElement_ = false;
+      serialize(t);
+    }
+
+    /*! \brief Ends an array.
+     *
+     * \sa beginArray()
+     */
+    void endArray();
+
 private:
     std::ostream &out_;
     EscapeOStream *escapeOut_, *stringLiteral_;
-    bool first_;
+    bool first_, firstElement_;
     Session *session_;
 
     void out(char);
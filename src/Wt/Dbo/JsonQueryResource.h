@@ -0,0 +1,131 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_DBO_JSON_QUERY_RESOURCE_H_
+#define WT_DBO_JSON_QUERY_RESOURCE_H_
+
+#include <Wt/WResource.h>
+#include <Wt/Dbo/Dbo.h>
+#include <Wt/Dbo/Json.h>
+
+#ifdef WT_THREADED
+#include <mutex>
+#endif // WT_THREADED
+
+namespace Wt {
+  namespace Dbo {
+
+/*! \class JsonQueryResource Wt/Dbo/JsonQueryResource.h Wt/Dbo/JsonQueryResource.h
+ *  \brief A resource that streams the results of a query as JSON.
+ *
+ * The resource serves the results of a query as a JSON array, using
+ * JsonSerializer to serialize each object. The results are not
+ * collected first: rows are serialized as they are fetched from the
+ * database.
+ *
+ * The response is sent in chunks of chunkSize() rows, using a
+ * Http::ResponseContinuation. Each chunk is fetched in its own
+ * transaction, using keyset pagination: the results are ordered by
+ * a key column (keyColumn(), by default the surrogate id), and each
+ * chunk continues after the key of the last object of the previous
+ * chunk. This keeps memory usage constant, and the cost of a chunk
+ * independent of its position, also for queries with a very large
+ * number of results. No transaction is kept open while the response
+ * is being sent to a slow client.
+ *
+ * Since the response is not read from a single snapshot, it reflects
+ * concurrent changes as follows: every object is returned at most
+ * once; an object that is inserted or deleted while the response is
+ * being sent is included only if its key is beyond the last chunk
+ * sent so far; and each object is serialized as it was when its chunk
+ * was read.
+ *
+ * The query's own orderBy() is replaced by the key order, and the
+ * query must not have a limit or offset itself. The condition on the
+ * key is added with where(), and its value is bound after the query's
+ * own parameters, so the query must not bind parameters that follow
+ * the where clause (e.g. for having()).
+ *
+ * Usage example:
+ * \code
+ * auto resource = std::make_shared<Wt::Dbo::JsonQueryResource<Post>>(
+ *     session.find<Post>().where("published"));
+ * server.addResource(resource, "/posts.json");
+ * \endcode
+ *
+ * The session of the query is used from within handleRequest(). When
+ * the resource is not bound to an application (e.g. a static resource
+ * added to the server), concurrent requests are serialized, and the
+ * session must not be used elsewhere.
+ *
+ * \ingroup dbo
+ */
+template <class C>
+class JsonQueryResource : public WResource
+{
+public:
+  /*! \brief Creates a resource for a query.
+   */
+  explicit JsonQueryResource(const Query< ptr<C> >& query,
+                             int chunkSize = 1000);
+
+  /*! \brief Destructor.
+   */
+  virtual ~JsonQueryResource();
+
+  /*! \brief Sets the number of rows in a chunk.
+   *
+   * The default chunk size is 1000 rows.
+   */
+  void setChunkSize(int rows);
+
+  /*! \brief Returns the number of rows in a chunk.
+   *
+   * \sa setChunkSize()
+   */
+  int chunkSize() const { return chunkSize_; }
+
+  /*! \brief Sets the key column.
+   *
+   * The key column must be unique and correspond to the object id,
+   * and is qualified as needed by the query, e.g. <tt>"p.id"</tt>
+   * for a query <tt>select p from post p</tt>.
+   *
+   * The default is the surrogate id column of the table of \p C, and
+   * must be set for a class with a natural id (which must be a
+   * single column).
+   */
+  void setKeyColumn(const std::string& column);
+
+  /*! \brief Returns the key column.
+   *
+   * Returns an empty string if the default is used.
+   *
+   * \sa setKeyColumn()
+   */
+  const std::string& keyColumn() const { return keyColumn_; }
+
+  virtual void handleRequest(const Http::Request& request,
+                             Http::Response& response) override;
+
+private:
+  Query< ptr<C> > query_;
+  int chunkSize_;
+  std::string keyColumn_;
+
+#ifdef WT_THREADED
+  std::mutex mutex_;
+#endif // WT_THREADED
+};
+
+  }
+}
+
+#ifndef WT_DBO_JSON_QUERY_RESOURCE_IMPL_H_
+#include <Wt/Dbo/JsonQueryResource_impl.h>
+#endif // WT_DBO_JSON_QUERY_RESOURCE_IMPL_H_
+
+#endif // WT_DBO_JSON_QUERY_RESOURCE_H_
@@ -0,0 +1,117 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_DBO_JSON_QUERY_RESOURCE_IMPL_H_
+#define WT_DBO_JSON_QUERY_RESOURCE_IMPL_H_
+
+#include <Wt/Dbo/JsonQueryResource.h>
+#include <Wt/Http/Request.h>
+#include <Wt/Http/Response.h>
+#include <Wt/Http/ResponseContinuation.h>
+
+namespace Wt {
+  namespace Dbo {
+
+template <class C>
+JsonQueryResource<C>::JsonQueryResource(const Query< ptr<C> >& query,
+                                        int chunkSize)
+  : query_(query),
+    chunkSize_(chunkSize)
+{ }
+
+template <class C>
+JsonQueryResource<C>::~JsonQueryResource()
+{
+  beingDeleted();
+}
+
+template <class C>
+void JsonQueryResource<C>::setChunkSize(int rows)
+{
+  chunkSize_ = rows;
+}
+
+template <class C>
+void JsonQueryResource<C>::setKeyColumn(const std::string& column)
+{
+  keyColumn_ = column;
+}
+
+template <class C>
+void JsonQueryResource<C>::handleRequest(const Http::Request& request,
+                                         Http::Response& response)
+{
+  typedef typename dbo_traits<C>::IdType IdType;
+
+  Http::ResponseContinuation *continuation = request.continuation();
+
+  if (!continuation)
+    response.setMimeType("application/json");
+
+  bool more = false;
+  IdType last = dbo_traits<C>::invalidId();
+
+  {
+#ifdef WT_THREADED
+    std::unique_lock<std::mutex> lock(mutex_);
+#endif // WT_THREADED
+
+    Session& session = query_.session();
+    Transaction t(session);
+
+    std::string key = keyColumn_;
+    if (key.empty()) {
+      const char *idField = dbo_traits<C>::surrogateIdField();
+      if (!idField)
+        throw Exception("JsonQueryResource: no key column for a class "
+                        "with a natural id");
+      key = session.tableNameQuoted<C>() + ".\"" + idField + '"';
+    }
+
+    Query< ptr<C> > query(query_);
+    query.orderBy(key);
+    if (continuation)
+      query.where(key + " > ?")
+        .bind(cpp17::any_cast<IdType>(continuation->data()));
+
+    /*
+     * Fetch one row more than needed, to know whether another chunk
+     * follows
+     */
+    query.limit(chunkSize_ + 1);
+
+    collection< ptr<C> > results = query.resultList();
+
+    JsonSerializer serializer(response.out());
+    serializer.beginArray(continuation != nullptr);
+
+    int count = 0;
+    for (typename collection< ptr<C> >::const_iterator i = results.begin();
+         i != results.end(); ++i) {
+      if (count == chunkSize_) {
+        more = true;
+        break;
+      }
+
+      serializer.serializeElement(*i);
+      last = i->id();
+      ++count;
+    }
+
+    if (!more)
+      serializer.endArray();
+  }
+
+  if (more) {
+    continuation = response.createContinuation();
+    continuation->setData(last);
+  }
+}
+
+  }
+}
+
+#endif // WT_DBO_JSON_QUERY_RESOURCE_IMPL_H_
@@ -9,6 +9,8 @@
 
 #include <vector>
 #include <iostream>
+#include <list>
+#include <unordered_map>
 
 #include <Wt/Dbo/SqlTraits.h>
 #include <Wt/Dbo/ptr.h>
@@ -28,6 +30,75 @@ namespace Wt {
       typedef std::vector<SelectField> SelectFieldList;
       typedef std::vector<SelectFieldList> SelectFieldLists;
 
+      struct QuerySql
+      {
+        std::string sql, countSql;
+      };
+
+      /*
+       * A cache of at most maxSize() entries, which evicts the least
+       * recently used entry when full.
+       */
+      template <typename Value>
+      class LruCache {
+      public:
+        LruCache(std::size_t maxSize)
+          : maxSize_(maxSize)
+        { }
+
+        std::size_t size() const { return index_.size(); }
+        std::size_t maxSize() const { return maxSize_; }
+
+        void setMaxSize(std::size_t size)
+        {
+          maxSize_ = size;
+          while (index_.size() > maxSize_)
+            evict();
+        }
+
+        const Value *find(const std::string& key)
+        {
+          auto i = index_.find(key);
+          if (i == index_.end())
+            return nullptr;
+
+          entries_.splice(entries_.begin(), entries_, i->second);
+          return &i->second->second;
+        }
+
+        void insert(const std::string& key, const Value& value)
+        {
+          if (maxSize_ == 0)
+            return;
+
+          auto i = index_.find(key);
+          if (i != index_.end()) {
+            i->second->second = value;
+            entries_.splice(entries_.begin(), entries_, i->second);
+            return;
+          }
+
+          if (index_.size() >= maxSize_)
+            evict();
+
+          entries_.emplace_front(key, value);
+          index_[key] = entries_.begin();
+        }
+
+      private:
+        typedef std::list<std::pair<std::string, Value> > Entries;
+
+        std::size_t maxSize_;
+        Entries entries_; // most recently used first
+        std::unordered_map<std::string, typename Entries::iterator> index_;
+
+        void evict()
+        {
+          index_.erase(entries_.back().first);
+          entries_.pop_back();
+        }
+      };
+
       template <class Result>
       class QueryBase {
       protected:
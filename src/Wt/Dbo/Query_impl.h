@@ -8,6 +8,7 @@
 #define WT_DBO_QUERY_IMPL_H_
 
 #include <tuple>
+#include <typeinfo>
 
 #include <Wt/Dbo/Exception.h>
 #include <Wt/Dbo/Field.h>
@@ -57,6 +58,18 @@ substituteFields(const SelectFieldList& list,
 extern void WTDBO_API
 parseSql(const std::string& sql, SelectFieldLists& fieldLists);
 
+extern std::string WTDBO_API
+querySqlKey(const std::type_info& resultType,
+            const std::string& sql,
+            const std::string& join,
+            const std::string& where,
+            const std::string& groupBy,
+            const std::string& having,
+            const std::string& orderBy,
+            int limit, int offset,
+            LimitQuery limitQueryMethod,
+            bool requireSubqueryAlias);
+
 template <class Result>
 QueryBase<Result>::QueryBase()
   : session_(nullptr)
@@ -67,7 +80,7 @@ QueryBase<Result>::QueryBase(Session& session, const std::string& sql)
   : session_(&session),
     sql_(sql)
 {
-  parseSql(sql_, selectFieldLists_);
+  session.parseQuery(sql_, selectFieldLists_);
 }
 
 template <class Result>
@@ -164,11 +177,26 @@ QueryBase<Result>::statements(const std::string& join,
                               const std::string& orderBy,
                               int limit, int offset) const
 {
-  std::string sql = createQuerySelectSql(join, where, groupBy, having, orderBy, limit, offset);
-  auto statement = this->session_->getOrPrepareStatement(sql);
+  std::string key = Impl::querySqlKey(typeid(Result), sql_, join, where,
+                                      groupBy, having, orderBy,
+                                      limit, offset,
+                                      this->session_->limitQueryMethod_,
+                                      this->session_->requireSubqueryAlias_);
+
+  const QuerySql *cached = this->session_->findQuerySql(key);
+  QuerySql sql;
+
+  if (!cached) {
+    sql.sql = createQuerySelectSql(join, where, groupBy, having, orderBy,
+                                   limit, offset);
+    sql.countSql = Impl::createQueryCountSql
+      (sql.sql, this->session_->requireSubqueryAlias_);
+    this->session_->cacheQuerySql(key, sql);
+    cached = &sql;
+  }
 
-  sql = Impl::createQueryCountSql(sql, this->session_->requireSubqueryAlias_);
-  auto countStatement = this->session_->getOrPrepareStatement(sql);
+  auto statement = this->session_->getOrPrepareStatement(cached->sql);
+  auto countStatement = this->session_->getOrPrepareStatement(cached->countSql);
 
   return std::make_pair(statement, countStatement);
 }
@@ -0,0 +1,150 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_DBO_ROUTING_SQL_CONNECTION_POOL_H_
+#define WT_DBO_ROUTING_SQL_CONNECTION_POOL_H_
+
+#include <Wt/Dbo/SqlConnectionPool.h>
+
+#include <chrono>
+#include <string>
+
+namespace Wt {
+  namespace Dbo {
+
+/*! \class RoutingSqlConnectionPool Wt/Dbo/RoutingSqlConnectionPool.h Wt/Dbo/RoutingSqlConnectionPool.h
+ *  \brief A connection pool that routes read-only transactions to replicas.
+ *
+ * This pool combines a pool for the primary database with pools for
+ * one or more read replicas. Read-only transactions (see
+ * TransactionMode::ReadOnly) use a connection from one of the
+ * replica pools, while all other transactions use the primary pool.
+ *
+ * Read-only transactions are distributed over the replicas in a
+ * round-robin fashion. A connection taken from a replica that has been
+ * idle for a while is first checked with the validationQuery(). When
+ * a replica pool fails to provide a connection (it throws an
+ * exception), or the connection fails this check, the replica is
+ * considered unhealthy and is skipped for the retryInterval(). When no
+ * replica is healthy, read-only transactions use the primary pool.
+ *
+ * Usage example:
+ * \code
+ * auto primary = std::make_unique<Wt::Dbo::FixedSqlConnectionPool>(
+ *     std::make_unique<Wt::Dbo::backend::Postgres>("host=primary ..."), 10);
+ * Wt::Dbo::RoutingSqlConnectionPool pool(std::move(primary));
+ * pool.addReplica(std::make_unique<Wt::Dbo::FixedSqlConnectionPool>(
+ *     std::make_unique<Wt::Dbo::backend::Postgres>("host=replica1 ..."), 10));
+ *
+ * session.setConnectionPool(pool);
+ *
+ * {
+ *   Wt::Dbo::Transaction t(session, Wt::Dbo::TransactionMode::ReadOnly);
+ *   // queries are executed on replica1
+ * }
+ * \endcode
+ *
+ * Keep in mind that replicas may lag behind the primary: a read-only
+ * transaction may not yet see the changes of a transaction that was
+ * just committed.
+ *
+ * \ingroup dbo
+ */
+class WTDBO_API RoutingSqlConnectionPool : public SqlConnectionPool
+{
+public:
+  /*! \brief Creates a routing pool.
+   *
+   * All read-write transactions use the \p primary pool.
+   */
+  explicit RoutingSqlConnectionPool(std::unique_ptr<SqlConnectionPool> primary);
+
+  virtual ~RoutingSqlConnectionPool();
+
+  /*! \brief Adds a pool for a read replica.
+   *
+   * Replicas must be added before the pool is used by sessions.
+   */
+  void addReplica(std::unique_ptr<SqlConnectionPool> replica);
+
+  /*! \brief Returns the number of replicas.
+   */
+  int replicaCount() const;
+
+  /*! \brief Returns whether a replica is currently considered healthy.
+   */
+  bool isReplicaHealthy(int index) const;
+
+  /*! \brief Marks a replica as unhealthy.
+   *
+   * The replica is skipped for the retryInterval(). This may be used
+   * by an application that detects a problem with a replica, for
+   * example excessive replication lag.
+   */
+  void setReplicaFailed(int index);
+
+  /*! \brief Sets the retry interval.
+   *
+   * An unhealthy replica is skipped for this interval, after which it
+   * is used again.
+   *
+   * The default interval is 10 seconds.
+   */
+  void setRetryInterval(std::chrono::steady_clock::duration interval);
+
+  /*! \brief Returns the retry interval.
+   *
+   * \sa setRetryInterval()
+   */
+  std::chrono::steady_clock::duration retryInterval() const;
+
+  /*! \brief Sets the query that checks a replica connection.
+   *
+   * When a connection from a replica was returned to this pool at
+   * least \p interval ago, this query is executed on it before it is
+   * used for a read-only transaction. If it throws an exception, the
+   * replica is marked as failed (see setReplicaFailed()), the
+   * connection is returned to its pool, and the next replica is
+   * tried. A zero \p interval checks every connection that is handed
+   * out, at the cost of an additional round trip per transaction.
+   *
+   * The default query is <tt>"select 1"</tt>, with an interval of 30
+   * seconds. For a database that needs a table in a select (like
+   * Firebird), use for example <tt>"select 1 from
+   * rdb$database"</tt>. An empty query disables the check.
+   */
+  void setValidationQuery(const std::string& sql,
+                          std::chrono::steady_clock::duration interval
+                            = std::chrono::seconds(30));
+
+  /*! \brief Returns the query that checks a replica connection.
+   *
+   * \sa setValidationQuery()
+   */
+  std::string validationQuery() const;
+
+  /*! \brief Returns the primary pool.
+   */
+  SqlConnectionPool& primary() const;
+
+  /*! \brief Returns a replica pool.
+   */
+  SqlConnectionPool& replica(int index) const;
+
+  virtual std::unique_ptr<SqlConnection> getConnection() override;
+  virtual std::unique_ptr<SqlConnection> getReadOnlyConnection() override;
+  virtual void returnConnection(std::unique_ptr<SqlConnection>) override;
+  virtual void prepareForDropTables() const override;
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+  }
+}
+
+#endif // WT_DBO_ROUTING_SQL_CONNECTION_POOL_H_
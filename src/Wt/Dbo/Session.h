@@ -7,10 +7,13 @@
 #ifndef WT_DBO_SESSION_H_
 #define WT_DBO_SESSION_H_
 
+#include <functional>
 #include <map>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <typeinfo>
+#include <unordered_map>
 
 #include <Wt/Dbo/ptr.h>
 #include <Wt/Dbo/Field.h>
@@ -26,6 +29,34 @@ namespace Wt {
       extern WTDBO_API std::string quoteSchemaDot(const std::string& table);
       template <class C, typename T> struct LoadHelper;
 
+      /*
+       * Whether an id type can be used as a key of a hashed container:
+       * it needs an enabled std::hash specialization and operator==.
+       */
+      template <typename T, typename Enable = void>
+      struct is_hashable_id : std::false_type { };
+
+      template <typename T>
+      struct is_hashable_id
+        <T, decltype(void(std::hash<T>()(std::declval<const T&>())),
+                     void(std::declval<const T&>() == std::declval<const T&>()))>
+        : std::true_type { };
+
+      /*
+       * Identity map container: hashed when the id type allows it,
+       * ordered otherwise (e.g. composite keys that only define operator<).
+       */
+      template <typename Id, typename V,
+                bool Hashed = is_hashable_id<Id>::value>
+      struct IdMap {
+        typedef std::map<Id, V> type;
+      };
+
+      template <typename Id, typename V>
+      struct IdMap<Id, V, true> {
+        typedef std::unordered_map<Id, V> type;
+      };
+
       struct WTDBO_API SetInfo {
         enum SetInfoFlags {
           // Normally, if there is no surrogate key, the field name of the natural id
@@ -62,6 +93,10 @@ namespace Wt {
         std::vector<SetInfo> sets;
 
         std::vector<std::string> statements;
+        std::vector<std::string> statementIds; // cache ids, parallel to statements
+
+        std::string batchSelectSql; // for batch fetching
+        int batchSelectSize;        // number of ids in batchSelectSql
 
         MappingInfo();
         virtual ~MappingInfo();
@@ -95,6 +130,7 @@ enum class FlushMode {
 class Call;
 //class SqlConnection;
 class SqlConnectionPool;
+class SharedCache;
 class SqlStatement;
 template <typename Result, typename BindStrategy> class Query;
 struct DirectBinding;
@@ -160,6 +196,75 @@ public:
    */
   void setConnectionPool(SqlConnectionPool& pool);
 
+  /*! \brief Sets a shared (second-level) cache.
+   *
+   * Objects of classes that are marked as cacheable (see
+   * dbo_traits::cacheable()) are then loaded from and stored in this
+   * cache, which is typically shared with other sessions.
+   *
+   * \sa sharedCache()
+   */
+  void setSharedCache(SharedCache& cache);
+
+  /*! \brief Returns the shared cache.
+   *
+   * Returns \c nullptr if no shared cache was set.
+   *
+   * \sa setSharedCache()
+   */
+  SharedCache *sharedCache() const { return sharedCache_; }
+
+  /*! \brief Sets the size of the query cache.
+   *
+   * The session caches, for queries created with query() and find(),
+   * the parsed select list and the generated SQL, keyed on the query
+   * text and the shape of the query (joins, conditions, ordering and
+   * whether a limit or offset is used). Recreating the same query
+   * then avoids parsing and building the SQL again.
+   *
+   * When the cache holds \p entries queries, the least recently used
+   * query is evicted to make room for a new one. A value of 0
+   * disables the cache.
+   *
+   * The default size is 256.
+   */
+  void setQueryCacheSize(std::size_t entries);
+
+  /*! \brief Returns the size of the query cache.
+   *
+   * \sa setQueryCacheSize()
+   */
+  std::size_t queryCacheSize() const { return queryCacheSize_; }
+
+  /*! \brief Sets the batch fetch size.
+   *
+   * When a database object that has not yet been loaded (for example
+   * the target of a ptr loaded with belongsTo()) is accessed, it is
+   * loaded with a separate query. Iterating over a collection and
+   * following a relation of each object therefore results in one
+   * query per object.
+   *
+   * When the batch fetch size is larger than 1, loading such an object
+   * also loads up to \p size - 1 other objects of the same class that
+   * were referenced in this session (while batch fetching was enabled)
+   * but have not yet been loaded, using a single <tt>where id in
+   * (...)</tt> query. The most recently referenced objects are loaded
+   * first.
+   *
+   * Batch fetching only applies to classes with a surrogate id, and
+   * is not used for classes that are loaded from a shared cache (see
+   * setSharedCache()).
+   *
+   * The default batch fetch size is 1, which disables batch fetching.
+   */
+  void setBatchFetchSize(int size);
+
+  /*! \brief Returns the batch fetch size.
+   *
+   * \sa setBatchFetchSize()
+   */
+  int batchFetchSize() const { return batchFetchSize_; }
+
   /*! \brief Maps a class to a database table.
    *
    * The class \p C is mapped to table with name \p tableName. You
@@ -417,6 +522,9 @@ public:
    * \code
    * session.execute("update user set name = ? where name = ?").bind("Bart").bind("Sarah");
    * \endcode
+   *
+   * This throws an Exception in a read-only transaction (see
+   * TransactionMode::ReadOnly).
    */
   Call execute(const std::string& sql);
 
@@ -563,9 +671,13 @@ private:
   template <class C>
   struct Mapping : public Impl::MappingInfo
   {
-    typedef std::map<typename dbo_traits<C>::IdType, MetaDbo<C> *> Registry;
+    typedef typename Impl::IdMap<typename dbo_traits<C>::IdType,
+                                 MetaDbo<C> *>::type Registry;
     Registry registry_;
 
+    // ids of objects created by loadLazy(), candidates for batch fetching
+    std::vector<typename dbo_traits<C>::IdType> unloaded_;
+
     virtual ~Mapping();
     virtual void init(Session& session) override;
     virtual void dropTable(Session& session,
@@ -597,11 +709,17 @@ private:
   std::vector<MetaDboBase*> objectsToAdd_;
   std::unique_ptr<SqlConnection> connection_;
   SqlConnectionPool *connectionPool_;
+  SharedCache *sharedCache_;
   Transaction::Impl *transaction_;
   FlushMode flushMode_;
   bool mustDiscardChange_;
   bool allowNestedTransaction_;
 
+  std::size_t queryCacheSize_;
+  int batchFetchSize_;
+  Impl::LruCache<Impl::SelectFieldLists> parsedQueries_;
+  Impl::LruCache<Impl::QuerySql> querySql_;
+
   void initSchema() const;
   void resolveJoinIds(Impl::MappingInfo *mapping);
   void prepareStatements(Impl::MappingInfo *mapping);
@@ -669,23 +787,35 @@ private:
   template<class C> void implTransactionDone(MetaDbo<C>& dbo, bool success);
   template<class C> void implLoad(MetaDbo<C>& dbo, SqlStatement *statement,
                                   int& column);
+  template<class C> void implLoadShared(MetaDbo<C>& dbo);
+  template<class C> bool implLoadBatch(MetaDbo<C>& dbo);
+  const std::string& batchSelectSql(Impl::MappingInfo *mapping);
+  void sharedCacheInvalidate(const char *tableName, const std::string& id);
+  long long sharedCacheGeneration() const;
 
   static std::string statementId(const char *table, int statementIdx);
 
   template <class C> SqlStatement *getStatement(int statementIdx);
   SqlStatement *getStatement(const std::string& id);
   SqlStatement *getStatement(const char *tableName, int statementIdx);
+  SqlStatement *getStatement(Impl::MappingInfo *mapping, int statementIdx);
   const std::string& getStatementSql(const char *tableName, int statementIdx);
+  const std::string& getStatementSql(Impl::MappingInfo *mapping,
+                                     int statementIdx);
 
   SqlStatement *prepareStatement(const std::string& id,
                                  const std::string& sql);
   SqlStatement *getOrPrepareStatement(const std::string& sql);
 
+  void parseQuery(const std::string& sql, Impl::SelectFieldLists& result);
+  const Impl::QuerySql *findQuerySql(const std::string& key);
+  void cacheQuerySql(const std::string& key, const Impl::QuerySql& sql);
+
   template <class C> void prepareStatements();
   template <class C> std::string manyToManyJoinId(const std::string& joinName,
                                                   const std::string& notId);
 
-  std::unique_ptr<SqlConnection> useConnection();
+  std::unique_ptr<SqlConnection> useConnection(bool readOnly = false);
   void returnConnection(std::unique_ptr<SqlConnection> connection);
   SqlConnection *connection(bool openTransaction);
 
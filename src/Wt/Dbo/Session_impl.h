@@ -7,9 +7,12 @@
 #ifndef WT_DBO_SESSION_IMPL_H_
 #define WT_DBO_SESSION_IMPL_H_
 
+#include <algorithm>
 #include <iostream>
 
+#include <Wt/Dbo/SharedCache.h>
 #include <Wt/Dbo/SqlConnection.h>
+#include <Wt/Dbo/SqlStatement.h>
 #include <Wt/Dbo/Query.h>
 
 namespace Wt {
@@ -58,16 +61,8 @@ SqlStatement *Session::getStatement(int statementIdx)
   initSchema();
 
   ClassRegistry::iterator i = classRegistry_.find(&typeid(C));
-  Impl::MappingInfo *mapping = i->second;
 
-  std::string id = statementId(mapping->tableName, statementIdx);
-
-  SqlStatement *result = getStatement(id);
-
-  if (!result)
-    result = prepareStatement(id, mapping->statements[statementIdx]);
-
-  return result;
+  return getStatement(i->second, statementIdx);
 }
 
 template <class C>
@@ -256,6 +251,23 @@ ptr<C> Session::loadLazy(const typename dbo_traits<C>::IdType& id)
     MetaDbo<C> *dbo = dynamic_cast<MetaDbo<C> *>(dbob);
     dbo->setId(id);
     mapping->registry_[id] = dbo;
+    if (batchFetchSize_ > 1 && mapping->surrogateIdFieldName) {
+      std::vector<typename dbo_traits<C>::IdType>& unloaded
+        = mapping->unloaded_;
+
+      // drop the ids of objects loaded or released in the meantime
+      if (unloaded.size() > 2 * mapping->registry_.size() + 16)
+        unloaded.erase
+          (std::remove_if(unloaded.begin(), unloaded.end(),
+                          [mapping](const typename dbo_traits<C>::IdType& u) {
+                            typename Mapping<C>::Registry::iterator j
+                              = mapping->registry_.find(u);
+                            return j == mapping->registry_.end()
+                              || j->second->isLoaded();
+                          }), unloaded.end());
+
+      unloaded.push_back(id);
+    }
     return ptr<C>(dbo);
   } else
     return ptr<C>(i->second);
@@ -362,6 +374,14 @@ void Session::implLoad(MetaDbo<C>& dbo, SqlStatement *statement, int& column)
   if (!transaction_)
     throw Exception("Dbo load(): no active transaction");
 
+  if (!statement && sharedCache_ && dbo_traits<C>::cacheable()) {
+    implLoadShared(dbo);
+    return;
+  }
+
+  if (!statement && batchFetchSize_ > 1 && implLoadBatch(dbo))
+    return;
+
   LoadDbAction<C> action(dbo, *getMapping<C>(), statement, column);
 
   C *obj = new C();
@@ -374,6 +394,111 @@ void Session::implLoad(MetaDbo<C>& dbo, SqlStatement *statement, int& column)
   }
 }
 
+template <class C>
+void Session::implLoadShared(MetaDbo<C>& dbo)
+{
+  Mapping<C> *mapping = getMapping<C>();
+  std::string tableName = mapping->tableName;
+  std::string id = dbo.idStr();
+
+  std::unique_ptr<SqlStatement> statement
+    = sharedCache_->find(tableName, id);
+  bool cached = statement != nullptr;
+
+  if (!cached) {
+    SqlStatement *select = getStatement<C>(SqlSelectById);
+    statement = sharedCache_->record(select);
+
+    select->reset();
+    int column = 0;
+    dbo.bindId(select, column);
+    select->execute();
+
+    if (!select->nextRow())
+      throw ObjectNotFoundException(mapping->tableName, id);
+  }
+
+  int column = 0;
+  LoadDbAction<C> action(dbo, *mapping, statement.get(), column);
+
+  C *obj = new C();
+  try {
+    action.visit(*obj);
+
+    if (!cached && statement->nextRow())
+      throw Exception("Dbo load: multiple rows for id " + id);
+  } catch (...) {
+    delete obj;
+    throw;
+  }
+
+  dbo.setObj(obj);
+
+  if (!cached)
+    sharedCache_->store(tableName, id, statement.get(),
+                        transaction_->cacheGeneration_);
+}
+
+template <class C>
+bool Session::implLoadBatch(MetaDbo<C>& dbo)
+{
+  Mapping<C> *mapping = getMapping<C>();
+
+  if (!mapping->surrogateIdFieldName)
+    return false;
+
+  std::vector<MetaDbo<C> *> batch;
+  batch.push_back(&dbo);
+
+  /*
+   * Take the batch from the ids of lazily created objects. Ids of
+   * objects that have since been loaded or released are dropped.
+   */
+  std::vector<typename dbo_traits<C>::IdType>& unloaded = mapping->unloaded_;
+  while (!unloaded.empty() && (int)batch.size() < batchFetchSize_) {
+    typename Mapping<C>::Registry::iterator i
+      = mapping->registry_.find(unloaded.back());
+    unloaded.pop_back();
+
+    if (i == mapping->registry_.end())
+      continue;
+
+    MetaDbo<C> *other = i->second;
+    if (other != &dbo && !other->isLoaded() && other->isPersisted()
+        && !other->isDeleted()
+        && std::find(batch.begin(), batch.end(), other) == batch.end())
+      batch.push_back(other);
+  }
+
+  if (batch.size() == 1)
+    return false;
+
+  SqlStatement *statement = getOrPrepareStatement(batchSelectSql(mapping));
+  ScopedStatementUse use(statement);
+
+  statement->reset();
+
+  /*
+   * Unused markers repeat the last id, so that a single statement
+   * serves all batches
+   */
+  int column = 0;
+  for (int i = 0; i < batchFetchSize_; ++i)
+    batch[std::min(i, (int)batch.size() - 1)]->bindId(statement, column);
+
+  statement->execute();
+
+  while (statement->nextRow()) {
+    column = 0;
+    mapping->load(*this, statement, column);
+  }
+
+  if (!dbo.isLoaded())
+    throw ObjectNotFoundException(mapping->tableName, dbo.idStr());
+
+  return true;
+}
+
 template <class C>
 Session::Mapping<C>::~Mapping()
 {
@@ -0,0 +1,168 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_DBO_SHARED_CACHE_H_
+#define WT_DBO_SHARED_CACHE_H_
+
+#include <Wt/Dbo/WDboDllDefs.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace Wt {
+  namespace Dbo {
+
+class SqlStatement;
+
+/*! \class SharedCache Wt/Dbo/SharedCache.h Wt/Dbo/SharedCache.h
+ *  \brief A second-level object cache, shared by sessions.
+ *
+ * Each Session keeps its own set of loaded objects. When many
+ * sessions read the same reference data (countries, products,
+ * permissions, ...), each of them loads it from the database and
+ * keeps its own copy in memory.
+ *
+ * A shared cache keeps the database values of objects that were
+ * loaded by id, so that other sessions that use the same cache can
+ * load these objects without accessing the database. Only classes for
+ * which dbo_traits::cacheable() returns \c true are cached:
+ *
+ * \code
+ * namespace Wt {
+ *   namespace Dbo {
+ *     template<>
+ *     struct dbo_traits<Country> : public dbo_default_traits {
+ *       static bool cacheable() { return true; }
+ *     };
+ *   }
+ * }
+ *
+ * Wt::Dbo::SharedCache cache;
+ *
+ * // for each session:
+ * session.setConnectionPool(pool);
+ * session.setSharedCache(cache);
+ * \endcode
+ *
+ * The cache is consulted when an object is loaded by its id, e.g.
+ * with Session::load() or when dereferencing a lazy ptr (such as the
+ * other side of a belongsTo() relation). Queries, as created with
+ * Session::find() or Session::query(), are still executed on the
+ * database.
+ *
+ * When a transaction saves or deletes an object of a cacheable class,
+ * the cached copy is invalidated when the transaction is done. A
+ * value that was read by a transaction which began before the object
+ * was last invalidated is not stored, since it may predate the change. Changes that are made to the database
+ * other than through sessions using this cache are not noticed: use
+ * invalidate() or clear() for these.
+ *
+ * The cache is bounded by an (estimated) amount of memory. When this
+ * limit is exceeded, the least recently used objects are evicted.
+ *
+ * The cache may be used concurrently by sessions in different threads.
+ *
+ * \ingroup dbo
+ */
+class WTDBO_API SharedCache
+{
+public:
+  /*! \brief Creates a shared cache.
+   *
+   * The cache will use at most (approximately) \p maxMemory bytes.
+   */
+  explicit SharedCache(std::size_t maxMemory = 16 * 1024 * 1024);
+
+  /*! \brief Destructor.
+   */
+  ~SharedCache();
+
+  SharedCache(const SharedCache&) = delete;
+  SharedCache& operator=(const SharedCache&) = delete;
+
+  /*! \brief Sets the memory bound.
+   *
+   * \sa maxMemory()
+   */
+  void setMaxMemory(std::size_t bytes);
+
+  /*! \brief Returns the memory bound.
+   *
+   * \sa setMaxMemory()
+   */
+  std::size_t maxMemory() const;
+
+  /*! \brief Returns the estimated memory used by the cached objects.
+   */
+  std::size_t memoryUsage() const;
+
+  /*! \brief Returns the number of cached objects.
+   */
+  std::size_t size() const;
+
+  /*! \brief Returns the number of loads that were served by the cache.
+   */
+  long long hits() const;
+
+  /*! \brief Returns the number of loads that were not served by the cache.
+   */
+  long long misses() const;
+
+  /*! \brief Invalidates all cached objects of a table.
+   */
+  void invalidate(const std::string& tableName);
+
+  /*! \brief Invalidates a single cached object.
+   *
+   * The \p id is the object id as formatted to a string (see
+   * ptr::id()).
+   */
+  void invalidate(const std::string& tableName, const std::string& id);
+
+  /*! \brief Invalidates all cached objects.
+   */
+  void clear();
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+
+  /*
+   * Returns the current generation, which is captured when a
+   * transaction begins.
+   */
+  long long generation() const;
+
+  /*
+   * Returns a statement that replays the cached row, or nullptr if it
+   * is not cached.
+   */
+  std::unique_ptr<SqlStatement> find(const std::string& tableName,
+                                     const std::string& id);
+
+  /*
+   * Returns a statement that records the results read from the
+   * current row of \p statement. It takes ownership of the statement
+   * use.
+   */
+  std::unique_ptr<SqlStatement> record(SqlStatement *statement);
+
+  /*
+   * Stores the row recorded by \p recording, unless the row (or its
+   * table) was invalidated since \p generation, the generation at
+   * which the reading transaction began.
+   */
+  void store(const std::string& tableName, const std::string& id,
+             SqlStatement *recording, long long generation);
+
+  friend class Session;
+};
+
+  }
+}
+
+#endif // WT_DBO_SHARED_CACHE_H_
@@ -10,6 +10,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <Wt/Dbo/WDboDllDefs.h>
 
@@ -44,8 +45,8 @@ class SqlStatement;
  *  \brief Abstract base class for an SQL connection.
  *
  * An sql connection manages a single connection to a database. It
- * also manages a map of previously prepared statements indexed by
- * id's.
+ * also manages a (hashed) map of previously prepared statements
+ * indexed by id's.
  *
  * This class is part of Wt::Dbo's backend API, and should not be used
  * directly.
@@ -312,7 +313,8 @@ protected:
   const std::vector<std::string>& getStatefulSql() const { return statefulSql_; }
 
 private:
-  typedef std::multimap<std::string, std::unique_ptr<SqlStatement>> StatementMap;
+  typedef std::unordered_multimap<std::string,
+                                  std::unique_ptr<SqlStatement>> StatementMap;
 
   StatementMap statementCache_;
   std::map<std::string, std::string> properties_;
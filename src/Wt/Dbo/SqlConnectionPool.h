@@ -46,6 +46,18 @@ public:
    */
   virtual std::unique_ptr<SqlConnection> getConnection() = 0;
 
+  /*! \brief Uses a connection from the pool for a read-only transaction.
+   *
+   * This method is called by a Session when a new read-only
+   * transaction is started (see TransactionMode::ReadOnly). A pool
+   * may then hand out a connection to a read replica.
+   *
+   * The connection is returned using returnConnection().
+   *
+   * The default implementation returns getConnection().
+   */
+  virtual std::unique_ptr<SqlConnection> getReadOnlyConnection();
+
   /*! \brief Returns a connection to the pool.
    *
    * This returns a connection to the pool. This method is called by a
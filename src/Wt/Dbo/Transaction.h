@@ -19,6 +19,15 @@ class SqlConnection;
 
 class ptr_base;
 
+/*! \brief Enumeration for the access mode of a transaction.
+ *
+ * \sa Transaction::Transaction(Session&, TransactionMode)
+ */
+enum class TransactionMode {
+  ReadWrite, //!< The transaction may modify the database
+  ReadOnly   //!< The transaction only reads from the database
+};
+
 /*! \class Transaction Wt/Dbo/Transaction.h Wt/Dbo/Transaction.h
  *  \brief A database transaction.
  *
@@ -79,6 +88,20 @@ public:
    */
   explicit Transaction(Session& session);
 
+  /*! \brief Constructor with an access mode.
+   *
+   * A TransactionMode::ReadOnly transaction takes its connection using
+   * SqlConnectionPool::getReadOnlyConnection(), which allows a pool to
+   * direct it to a read replica (see RoutingSqlConnectionPool). Such a
+   * transaction cannot flush modified objects: this throws an
+   * Exception.
+   *
+   * A nested transaction uses the mode of the outermost transaction. It
+   * is an error to nest a read-write transaction in a read-only
+   * transaction.
+   */
+  Transaction(Session& session, TransactionMode mode);
+
   /*! \brief Destructor.
    *
    * Under normal circumstances, the destructor will attempt to \link commit() commit\endlink the transaction
@@ -136,12 +159,20 @@ public:
    */
   SqlConnection *connection() const;
 
+  /*! \brief Returns whether this is a read-only transaction.
+   *
+   * \sa Transaction(Session&, TransactionMode)
+   */
+  bool isReadOnly() const;
+
 private:
   struct Impl {
     Session& session_;
     bool active_;
     bool needsRollback_;
     bool open_;
+    bool readOnly_;
+    long long cacheGeneration_;
 
     int transactionCount_;
     std::vector<ptr_base *> objects_;
@@ -152,7 +183,7 @@ private:
     void commit();
     void rollback();
 
-    Impl(Session& session_);
+    Impl(Session& session_, bool readOnly);
     ~Impl();
   };
 
@@ -162,6 +193,7 @@ private:
 
   friend class Session;
 
+  void init(TransactionMode mode);
   void release();
 };
 
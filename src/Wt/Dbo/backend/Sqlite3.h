@@ -11,6 +11,8 @@
 #include <Wt/Dbo/SqlStatement.h>
 #include <Wt/Dbo/backend/WDboSqlite3DllDefs.h>
 
+#include <chrono>
+
 extern "C" {
   struct sqlite3;
 }
@@ -64,6 +66,20 @@ enum class DateTimeStorage {
   UnixTimeAsInteger
 };
 
+/*! \enum JournalMode
+ *  \brief The journal mode of an SQLite3 database.
+ *
+ * \sa Sqlite3::setJournalMode()
+ */
+enum class JournalMode {
+  Delete,   //!< Rollback journal, deleted at the end of a transaction
+  Truncate, //!< Rollback journal, truncated at the end of a transaction
+  Persist,  //!< Rollback journal, invalidated at the end of a transaction
+  Memory,   //!< Rollback journal kept in memory
+  WAL,      //!< Write-ahead log, which allows readers concurrent with a writer
+  Off       //!< No journal
+};
+
 /*! \class Sqlite3 Wt/Dbo/backend/Sqlite3.h Wt/Dbo/backend/Sqlite3.h
  *  \brief An SQLite3 connection
  *
@@ -76,7 +92,9 @@ class WTDBOSQLITE3_API Sqlite3 : public SqlConnection
 public:
   /*! \brief Opens a new SQLite3 backend connection.
    *
-   * The \p db may be any of the values supported by sqlite3_open().
+   * The \p db may be any of the values supported by sqlite3_open(),
+   * including URI filenames (e.g.
+   * <tt>"file:db?mode=memory&cache=shared"</tt>).
    */
   Sqlite3(const std::string& db);
 
@@ -110,6 +128,70 @@ public:
    */
   DateTimeStorage dateTimeStorage(SqlDateTimeType type) const;
 
+  /*! \brief Sets the journal mode.
+   *
+   * The WAL journal mode allows readers to proceed concurrently with a
+   * writer, and is recommended when the database is used by several
+   * connections (see Sqlite3ConnectionPool). The journal mode of a WAL
+   * database is persistent, but other modes need to be set on each
+   * connection.
+   *
+   * By default, the journal mode is not changed, and SQLite uses the
+   * Delete mode for a new database.
+   */
+  void setJournalMode(JournalMode mode);
+
+  /*! \brief Returns the journal mode.
+   *
+   * \sa setJournalMode()
+   */
+  JournalMode journalMode() const { return journalMode_; }
+
+  /*! \brief Sets the busy timeout.
+   *
+   * When the database is locked by another connection, the connection
+   * retries, with an exponentially increasing delay of up to 100 ms
+   * between attempts, until the lock is released or this timeout
+   * expires. After the timeout, the statement fails with an exception.
+   *
+   * The default timeout is 1 second.
+   */
+  void setBusyTimeout(std::chrono::milliseconds timeout);
+
+  /*! \brief Returns the busy timeout.
+   *
+   * \sa setBusyTimeout()
+   */
+  std::chrono::milliseconds busyTimeout() const { return busyTimeout_; }
+
+  /*! \brief Sets the maximum size for memory-mapped I/O.
+   *
+   * A value of 0 disables memory-mapped I/O. A negative value (the
+   * default) leaves the SQLite default.
+   */
+  void setMmapSize(long long bytes);
+
+  /*! \brief Returns the maximum size for memory-mapped I/O.
+   *
+   * \sa setMmapSize()
+   */
+  long long mmapSize() const { return mmapSize_; }
+
+  /*! \brief Makes the connection read-only.
+   *
+   * A read-only connection fails any statement that modifies the
+   * database.
+   *
+   * \sa Sqlite3ConnectionPool
+   */
+  void setReadOnly(bool readOnly);
+
+  /*! \brief Returns whether the connection is read-only.
+   *
+   * \sa setReadOnly()
+   */
+  bool isReadOnly() const { return readOnly_; }
+
   virtual void startTransaction() override;
   virtual void commitTransaction() override;
   virtual void rollbackTransaction() override;
@@ -138,7 +220,16 @@ private:
   std::string conn_;
   sqlite3 *db_;
 
+  bool journalModeSet_;
+  JournalMode journalMode_;
+  std::chrono::milliseconds busyTimeout_;
+  long long mmapSize_;
+  bool readOnly_;
+
+  void open();
   void init();
+  void applyJournalMode();
+  void applyReadOnly();
 };
 
     }
@@ -0,0 +1,84 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_DBO_BACKEND_SQLITE3_CONNECTION_POOL_H_
+#define WT_DBO_BACKEND_SQLITE3_CONNECTION_POOL_H_
+
+#include <Wt/Dbo/SqlConnectionPool.h>
+#include <Wt/Dbo/backend/Sqlite3.h>
+
+#include <chrono>
+
+namespace Wt {
+  namespace Dbo {
+    namespace backend {
+
+/*! \class Sqlite3ConnectionPool Wt/Dbo/backend/Sqlite3ConnectionPool.h Wt/Dbo/backend/Sqlite3ConnectionPool.h
+ *  \brief A connection pool for an SQLite3 database with many readers.
+ *
+ * SQLite3 allows only one writer at a time, but in WAL journal mode,
+ * readers do not block the writer and vice versa. This pool therefore
+ * holds a single connection for read-write transactions, and a number
+ * of read-only connections (see Sqlite3::setReadOnly()) for read-only
+ * transactions (see TransactionMode::ReadOnly).
+ *
+ * The connection passed to the constructor is switched to the WAL
+ * journal mode, and is used for read-write transactions. The read-only
+ * connections are cloned from it.
+ *
+ * Usage example:
+ * \code
+ * auto connection = std::make_unique<Wt::Dbo::backend::Sqlite3>("blog.db");
+ * connection->setBusyTimeout(std::chrono::seconds(5));
+ * Wt::Dbo::backend::Sqlite3ConnectionPool pool(std::move(connection), 8);
+ *
+ * session.setConnectionPool(pool);
+ *
+ * {
+ *   Wt::Dbo::Transaction t(session, Wt::Dbo::TransactionMode::ReadOnly);
+ *   // uses one of the 8 read-only connections
+ * }
+ * \endcode
+ *
+ * \ingroup dbo
+ */
+class WTDBOSQLITE3_API Sqlite3ConnectionPool : public SqlConnectionPool
+{
+public:
+  /*! \brief Creates a connection pool.
+   *
+   * The pool uses \p connection for read-write transactions, and
+   * \p readers read-only connections for read-only transactions.
+   */
+  Sqlite3ConnectionPool(std::unique_ptr<Sqlite3> connection, int readers);
+
+  virtual ~Sqlite3ConnectionPool();
+
+  /*! \brief Returns the number of read-only connections.
+   */
+  int readers() const;
+
+  /*! \brief Set a timeout to get a connection.
+   *
+   * \sa FixedSqlConnectionPool::setTimeout()
+   */
+  void setTimeout(std::chrono::steady_clock::duration timeout);
+
+  virtual std::unique_ptr<SqlConnection> getConnection() override;
+  virtual std::unique_ptr<SqlConnection> getReadOnlyConnection() override;
+  virtual void returnConnection(std::unique_ptr<SqlConnection>) override;
+  virtual void prepareForDropTables() const override;
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+    }
+  }
+}
+
+#endif // WT_DBO_BACKEND_SQLITE3_CONNECTION_POOL_H_
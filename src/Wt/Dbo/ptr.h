@@ -182,6 +182,12 @@ struct dbo_default_traits
    * <tt>"version"</tt> field.
    */
   static const char *versionField() { return "version"; }
+
+  /*! \brief Returns whether objects may be kept in a shared cache.
+   *
+   * By default, objects are not cached.
+   */
+  static bool cacheable() { return false; }
 };
 
 /*! \class dbo_traits Wt/Dbo/Dbo Wt/Dbo/Dbo
@@ -252,6 +258,9 @@ struct dbo_traits : public dbo_default_traits
    *  - comparison operator (for use as a key in a std::map): <tt>id == id</tt>
    *  - less than operator (for use as a key in a std::map): <tt>id < id</tt>
    *
+   * If in addition <tt>std::hash</tt> is specialized for the id type,
+   * the session keeps its loaded objects in a hashed map instead.
+   *
    * Only the default <tt>long long</tt> is supported for an
    * auto-incrementing surrogate primary key. You need to change the
    * default key type typically in conjuction with specifying a natural id,
@@ -335,6 +344,17 @@ struct dbo_traits : public dbo_default_traits
    * together for your class by returning \c nullptr instead.
    */
   static const char *versionField();
+
+  /*! \brief Configures whether objects may be kept in a shared cache.
+   *
+   * When a session uses a SharedCache, objects of a class for which
+   * this returns \c true are loaded from that cache when available.
+   * This is only useful for data that is rarely modified, such as
+   * reference data.
+   *
+   * \sa Session::setSharedCache()
+   */
+  static bool cacheable();
 #endif // DOXYGEN_ONLY
 };
 
@@ -148,6 +148,9 @@ void MetaDbo<C>::doTransactionDone(bool success)
 {
   Session *s = session();
 
+  if (dbo_traits<C>::cacheable())
+    s->sharedCacheInvalidate(getMapping()->tableName, idStr());
+
   if (success) {
     if (deletedInTransaction()) {
       prune();
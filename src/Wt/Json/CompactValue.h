@@ -0,0 +1,342 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_JSON_COMPACT_VALUE_H_
+#define WT_JSON_COMPACT_VALUE_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <Wt/Json/Value.h>
+
+namespace Wt {
+  namespace Json {
+
+class CompactObject;
+class CompactValue;
+
+/*! \brief A compact JSON array.
+ *
+ * \ingroup json
+ */
+typedef std::vector<CompactValue> CompactArray;
+
+/*! \class CompactValue Wt/Json/CompactValue.h Wt/Json/CompactValue.h
+ *  \brief A compact JSON value.
+ *
+ * This is an alternative to Value, for applications that keep large
+ * JSON documents in memory, or that only read a parsed document.
+ *
+ * A CompactValue occupies 16 bytes. Null, boolean and number values
+ * and strings of up to 15 bytes are stored inline, without any
+ * allocation. Longer strings use a single allocation. Objects are
+ * stored as a CompactObject: a vector of members in document order,
+ * rather than a map.
+ *
+ * Strings are always UTF-8 encoded.
+ *
+ * A CompactValue can be converted from and to a Value, and can be
+ * parsed directly from JSON, using parse(const std::string&,
+ * CompactValue&, bool), and serialized with serialize(const
+ * CompactValue&, int).
+ *
+ * \ingroup json
+ */
+class WT_API CompactValue
+{
+public:
+  /*! \brief Creates a \link Wt::Json::Type::Null Null\endlink value.
+   */
+  CompactValue();
+
+  /*! \brief Creates a value of the given type.
+   *
+   * The value is \c false, 0, an empty string, an empty array or an
+   * empty object.
+   */
+  explicit CompactValue(Type type);
+
+  /*! \brief Creates a boolean value.
+   */
+  CompactValue(bool value);
+
+  /*! \brief Creates a number value.
+   */
+  CompactValue(int value);
+
+  /*! \brief Creates a number value.
+   */
+  CompactValue(long value);
+
+  /*! \brief Creates a number value.
+   */
+  CompactValue(long long value);
+
+  /*! \brief Creates a number value.
+   */
+  CompactValue(double value);
+
+  /*! \brief Creates a string value from a UTF-8 encoded string.
+   */
+  CompactValue(const char *value);
+
+  /*! \brief Creates a string value from a UTF-8 encoded string.
+   */
+  CompactValue(const char *value, std::size_t size);
+
+  /*! \brief Creates a string value from a UTF-8 encoded string.
+   */
+  CompactValue(const std::string& value);
+
+  /*! \brief Creates an array value.
+   */
+  CompactValue(CompactArray&& value);
+
+  /*! \brief Creates an object value.
+   */
+  CompactValue(CompactObject&& value);
+
+  /*! \brief Copy constructor.
+   */
+  CompactValue(const CompactValue& other);
+
+  /*! \brief Move constructor.
+   */
+  CompactValue(CompactValue&& other) noexcept;
+
+  ~CompactValue();
+
+  /*! \brief Assignment operator.
+   */
+  CompactValue& operator= (const CompactValue& other);
+
+  /*! \brief Move assignment operator.
+   */
+  CompactValue& operator= (CompactValue&& other) noexcept;
+
+  /*! \brief Compares two values.
+   *
+   * Objects are equal when they have the same members in the same
+   * order.
+   */
+  bool operator== (const CompactValue& other) const;
+
+  /*! \brief Compares two values.
+   */
+  bool operator!= (const CompactValue& other) const;
+
+  /*! \brief Converts a Value.
+   */
+  static CompactValue fromValue(const Value& value);
+
+  /*! \brief Converts to a Value.
+   */
+  Value toValue() const;
+
+  /*! \brief Returns the type.
+   */
+  Type type() const;
+
+  /*! \brief Returns whether the value is \link Wt::Json::Type::Null
+   *         Null\endlink.
+   */
+  bool isNull() const { return tag_ == TagNull; }
+
+  /*! \brief Returns the boolean value.
+   *
+   * \throws TypeException if the value is not a boolean.
+   */
+  bool boolValue() const;
+
+  /*! \brief Returns the number value.
+   *
+   * \throws TypeException if the value is not a number.
+   */
+  double numberValue() const;
+
+  /*! \brief Returns the string value (UTF-8).
+   *
+   * \throws TypeException if the value is not a string.
+   */
+  std::string stringValue() const;
+
+  /*! \brief Returns the characters of a string value.
+   *
+   * These are not necessarily null-terminated: see stringSize().
+   *
+   * \throws TypeException if the value is not a string.
+   */
+  const char *stringData() const;
+
+  /*! \brief Returns the size of a string value.
+   *
+   * \throws TypeException if the value is not a string.
+   */
+  std::size_t stringSize() const;
+
+  /*! \brief Returns whether this is a string with the given value.
+   */
+  bool stringEquals(const char *value, std::size_t size) const;
+
+  /*! \brief Returns the array.
+   *
+   * \throws TypeException if the value is not an array.
+   */
+  const CompactArray& array() const;
+
+  /*! \brief Returns the array.
+   *
+   * \throws TypeException if the value is not an array.
+   */
+  CompactArray& array();
+
+  /*! \brief Returns the object.
+   *
+   * \throws TypeException if the value is not an object.
+   */
+  const CompactObject& object() const;
+
+  /*! \brief Returns the object.
+   *
+   * \throws TypeException if the value is not an object.
+   */
+  CompactObject& object();
+
+  /*! \brief Returns an object member.
+   *
+   * Returns Null if this is not an object, or when it does not have
+   * a member with this name.
+   */
+  const CompactValue& get(const std::string& name) const;
+
+  /*! \brief A \link Wt::Json::Type::Null Null\endlink value.
+   */
+  static const CompactValue Null;
+
+private:
+  enum : unsigned char {
+    MaxSmallString = 15, // tags 0 - 15: inline string of that size
+    TagNull,
+    TagFalse,
+    TagTrue,
+    TagNumber,
+    TagString,           // data_ holds a pointer to a LargeString
+    TagArray,            // data_ holds a CompactArray *
+    TagObject            // data_ holds a CompactObject *
+  };
+
+  struct LargeString;
+
+  alignas(8) char data_[15];
+  unsigned char tag_;
+
+  void setString(const char *value, std::size_t size);
+  void copy(const CompactValue& other);
+  void release();
+
+  template <typename T> T *pointer() const;
+  template <typename T> void setPointer(T *p);
+};
+
+/*! \class CompactObject Wt/Json/CompactValue.h Wt/Json/CompactValue.h
+ *  \brief A compact JSON object.
+ *
+ * The members are stored in a vector, in the order in which they were
+ * added. A member is found with a linear search. For large objects,
+ * buildIndex() creates a sorted index that is used instead, until the
+ * object is modified. parse() creates an index for each object with at
+ * least IndexThreshold members.
+ *
+ * Members with the same name are not merged: a lookup returns the
+ * member that was added last, consistent with how an Object is parsed.
+ *
+ * \ingroup json
+ */
+class WT_API CompactObject
+{
+public:
+  /*! \brief A member. */
+  struct Member {
+    CompactValue name;  //!< the name (a string)
+    CompactValue value; //!< the value
+  };
+
+  typedef std::vector<Member>::const_iterator const_iterator;
+
+  /*! \brief The size from which parse() creates an index. */
+  static const std::size_t IndexThreshold = 16;
+
+  /*! \brief Returns the number of members. */
+  std::size_t size() const { return members_.size(); }
+
+  /*! \brief Returns whether the object is empty. */
+  bool empty() const { return members_.empty(); }
+
+  /*! \brief Returns an iterator to the first member. */
+  const_iterator begin() const { return members_.begin(); }
+
+  /*! \brief Returns an iterator past the last member. */
+  const_iterator end() const { return members_.end(); }
+
+  /*! \brief Reserves space for members. */
+  void reserve(std::size_t size) { members_.reserve(size); }
+
+  /*! \brief Adds a member.
+   *
+   * The member is added, even if a member with the same name already
+   * exists. Returns a reference to the value of the new member.
+   *
+   * \throws TypeException if \p name is not a string.
+   */
+  CompactValue& add(CompactValue name, CompactValue value);
+
+  /*! \brief Returns a member value, adding a Null member if needed.
+   */
+  CompactValue& operator[] (const std::string& name);
+
+  /*! \brief Finds a member value.
+   *
+   * Returns \c nullptr if there is no member with the given name.
+   */
+  const CompactValue *find(const char *name, std::size_t size) const;
+
+  /*! \brief Finds a member value.
+   *
+   * Returns \c nullptr if there is no member with the given name.
+   */
+  const CompactValue *find(const std::string& name) const;
+
+  /*! \brief Returns whether a member exists.
+   */
+  bool contains(const std::string& name) const;
+
+  /*! \brief Returns a member value, or Null if it does not exist.
+   */
+  const CompactValue& get(const std::string& name) const;
+
+  /*! \brief Creates an index to speed up lookups.
+   *
+   * The index is discarded when a member is added.
+   */
+  void buildIndex();
+
+  /*! \brief Returns whether the object has an index.
+   */
+  bool hasIndex() const { return !index_.empty(); }
+
+  bool operator== (const CompactObject& other) const;
+
+private:
+  std::vector<Member> members_;
+  std::vector<std::uint32_t> index_; // positions, sorted by name
+
+  int findPosition(const char *name, std::size_t size) const;
+};
+
+  }
+}
+
+#endif // WT_JSON_COMPACT_VALUE_H_
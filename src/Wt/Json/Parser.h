@@ -16,6 +16,7 @@ namespace Wt {
 class Object;
 class Value;
 class Array;
+class CompactValue;
 
 /*! \brief A parse error.
  *
@@ -130,6 +131,127 @@ WT_API extern void parse(const std::string& input, Array& result,
 WT_API extern bool parse(const std::string& input, Array& result,
                          ParseError& error, bool validateUTF8 = true);
 
+#ifndef WT_TARGET_JAVA
+
+/*! \brief Parse function
+ *
+ * This function parses the input string (which represents a UTF-8
+ * JSON-encoded data structure) into the compact \p result value. On
+ * success, the result value contains either an array or an object.
+ *
+ * If validateUTF8 is true, the parser will sanitize (security scan for
+ * invalid UTF-8) the UTF-8 input string before parsing starts.
+ *
+ * \throws ParseError when the input is not a correct JSON structure.
+ *
+ * \ingroup json
+ */
+WT_API extern void parse(const std::string& input, CompactValue& result,
+                         bool validateUTF8 = true);
+
+/*! \brief Parse function
+ *
+ * This function parses the input string (which represents a UTF-8
+ * JSON-encoded data structure) into the compact \p result value. On
+ * success, the result value contains either an array or an object.
+ *
+ * If validateUTF8 is true, the parser will sanitize (security scan for
+ * invalid UTF-8) the UTF-8 input string before parsing starts.
+ *
+ * This method returns \c true if the parse was succesful, or reports an
+ * error in into the \p error value otherwise.
+ *
+ * \ingroup json
+ */
+WT_API extern bool parse(const std::string& input, CompactValue& result,
+                         ParseError& error, bool validateUTF8 = true);
+
+/*! \class Handler Wt/Json/Parser.h Wt/Json/Parser.h
+ *  \brief An event handler for parsing JSON.
+ *
+ * The parse(const std::string&, Handler&, bool) function reports the
+ * structure of a JSON document to a handler, as a sequence of events,
+ * without building a Value tree.
+ *
+ * Each method returns whether parsing should continue: returning \c
+ * false stops parsing (without an error), and the remainder of the
+ * input is not checked. The default implementations return \c true.
+ *
+ * \sa Reader
+ *
+ * \ingroup json
+ */
+class WT_API Handler
+{
+public:
+  virtual ~Handler();
+
+  /*! \brief Start of an object. */
+  virtual bool startObject();
+
+  /*! \brief End of an object. */
+  virtual bool endObject();
+
+  /*! \brief Start of an array. */
+  virtual bool startArray();
+
+  /*! \brief End of an array. */
+  virtual bool endArray();
+
+  /*! \brief The name of an object member.
+   *
+   * This is followed by the events for the member's value.
+   */
+  virtual bool key(const std::string& name);
+
+  /*! \brief A (UTF-8 encoded) string value. */
+  virtual bool string(const std::string& value);
+
+  /*! \brief A number value. */
+  virtual bool number(double value);
+
+  /*! \brief A boolean value. */
+  virtual bool boolean(bool value);
+
+  /*! \brief A null value. */
+  virtual bool null();
+};
+
+/*! \brief Parse function
+ *
+ * This function parses the input string (which represents a UTF-8
+ * JSON-encoded data structure), and reports its structure to the \p
+ * handler.
+ *
+ * If validateUTF8 is true, the parser will sanitize (security scan for
+ * invalid UTF-8) the UTF-8 input string before parsing starts.
+ *
+ * \throws ParseError when the input is not a correct JSON structure.
+ *
+ * \ingroup json
+ */
+WT_API extern void parse(const std::string& input, Handler& handler,
+                         bool validateUTF8 = true);
+
+/*! \brief Parse function
+ *
+ * This function parses the input string (which represents a UTF-8
+ * JSON-encoded data structure), and reports its structure to the \p
+ * handler.
+ *
+ * If validateUTF8 is true, the parser will sanitize (security scan for
+ * invalid UTF-8) the UTF-8 input string before parsing starts.
+ *
+ * This method returns \c true if the parse was succesful, or reports an
+ * error in into the \p error value otherwise.
+ *
+ * \ingroup json
+ */
+WT_API extern bool parse(const std::string& input, Handler& handler,
+                         ParseError& error, bool validateUTF8 = true);
+
+#endif // WT_TARGET_JAVA
+
 #ifdef WT_TARGET_JAVA
     class Parser {
       Object parse(const std::string& input, bool validateUTF8 = true);
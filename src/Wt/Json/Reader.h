@@ -0,0 +1,194 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_JSON_READER_H_
+#define WT_JSON_READER_H_
+
+#include <memory>
+#include <string>
+#include <Wt/Json/Parser.h>
+
+namespace Wt {
+  namespace Json {
+
+class CompactValue;
+
+/*! \brief Enumeration for the tokens returned by a Reader.
+ *
+ * \sa Reader::next()
+ *
+ * \ingroup json
+ */
+enum class Token {
+  StartObject, //!< '{'
+  EndObject,   //!< '}'
+  StartArray,  //!< '['
+  EndArray,    //!< ']'
+  Name,        //!< an object member name
+  String,      //!< a string value
+  Number,      //!< a number value
+  Bool,        //!< "true" or "false"
+  Null,        //!< "null"
+  End          //!< the end of the input
+};
+
+/*! \class Reader Wt/Json/Reader.h Wt/Json/Reader.h
+ *  \brief An on-demand JSON reader.
+ *
+ * Unlike parse(), which builds a complete Value tree, this class
+ * reads the JSON input one token at a time. The value of a string or
+ * number token is only decoded when it is requested, and a complete
+ * object or array can be skipped without decoding it.
+ *
+ * This makes it possible to extract a few members from a large
+ * document, or to process the elements of a large array one by one,
+ * without materializing the whole document:
+ *
+ * \code
+ * Json::Reader reader(body);
+ *
+ * if (reader.next() == Json::Token::StartObject
+ *     && reader.findMember("items")
+ *     && reader.next() == Json::Token::StartArray) {
+ *   while (reader.next() != Json::Token::EndArray) {
+ *     Json::Value item;
+ *     reader.readValue(item); // or look for a member with findMember()
+ *     ...
+ *   }
+ * }
+ * \endcode
+ *
+ * Like parse(), the reader requires that the document is an object or
+ * an array, and it throws a ParseError when the input is not a correct
+ * JSON structure. A value that is skipped, with skip() or
+ * findMember(), is only scanned for matching brackets and string
+ * delimiters, and is not otherwise checked.
+ *
+ * The reader does not copy the input: it must remain valid for the
+ * lifetime of the reader, unless it is sanitized (see the
+ * constructor).
+ *
+ * \ingroup json
+ */
+class WT_API Reader
+{
+public:
+  /*! \brief Creates a reader for the given input.
+   *
+   * The input represents a UTF-8 JSON-encoded data structure.
+   *
+   * If validateUTF8 is true, the input is first checked for invalid
+   * UTF-8. Only when it contains invalid UTF-8, a sanitized copy is
+   * made, like parse() does.
+   */
+  explicit Reader(const std::string& input, bool validateUTF8 = true);
+
+  // the input must outlive the reader
+  Reader(std::string&& input, bool validateUTF8 = true) = delete;
+
+  Reader(const Reader&) = delete;
+  Reader& operator=(const Reader&) = delete;
+
+  ~Reader();
+
+  /*! \brief Reads the next token.
+   *
+   * After the document has been read completely, this returns
+   * Token::End.
+   *
+   * \throws ParseError when the input is not a correct JSON structure.
+   */
+  Token next();
+
+  /*! \brief Returns the current token.
+   *
+   * \sa next()
+   */
+  Token token() const;
+
+  /*! \brief Returns the nesting depth.
+   *
+   * This is the number of objects and arrays that contain the current
+   * token. A Token::StartObject or Token::StartArray token is
+   * considered to be inside the container it starts.
+   */
+  int depth() const;
+
+  /*! \brief Returns the value of a string or name token.
+   *
+   * The returned reference remains valid until the next call to
+   * next().
+   *
+   * \throws TypeException when the current token is not a
+   *         Token::String or Token::Name.
+   */
+  const std::string& stringValue();
+
+  /*! \brief Returns the value of a number token.
+   *
+   * \throws TypeException when the current token is not a
+   *         Token::Number.
+   */
+  double numberValue();
+
+  /*! \brief Returns the value of a boolean token.
+   *
+   * \throws TypeException when the current token is not a Token::Bool.
+   */
+  bool boolValue() const;
+
+  /*! \brief Skips the current value.
+   *
+   * When the current token is a Token::StartObject or
+   * Token::StartArray, the whole object or array is skipped, and the
+   * current token becomes the matching Token::EndObject or
+   * Token::EndArray. For other tokens, this does nothing.
+   */
+  void skip();
+
+  /*! \brief Finds a member in the current object.
+   *
+   * This reads (and skips the values of) the remaining members of the
+   * current object until a member with the given \p name is found. The
+   * current token then is its Token::Name, and next() returns its
+   * value.
+   *
+   * Returns \c false if the object does not contain such a member. The
+   * current token then is the Token::EndObject of the object.
+   *
+   * This must be called after a Token::StartObject, or after the value
+   * of a member.
+   */
+  bool findMember(const std::string& name);
+
+  /*! \brief Reads the current value.
+   *
+   * This reads the value that starts at the current token into \p
+   * result. When the current token is a Token::StartObject or
+   * Token::StartArray, the whole object or array is read, and the
+   * current token becomes the matching Token::EndObject or
+   * Token::EndArray.
+   *
+   * \throws WException when the current token is not the start of a
+   *         value.
+   */
+  void readValue(Value& result);
+
+  /*! \brief Reads the current value.
+   *
+   * \sa readValue(Value&)
+   */
+  void readValue(CompactValue& result);
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+  }
+}
+
+#endif // WT_JSON_READER_H_
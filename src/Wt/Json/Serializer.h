@@ -8,14 +8,19 @@
 #define WT_JSON_SERIALIZER_H
 
 #include <Wt/WDllDefs.h>
+#include <iosfwd>
 #include <string>
 
 namespace Wt {
 class EscapeOStream;
+class WStringStream;
   namespace Json {
 
+class Value;
+
 class Object;
 class Array;
+class CompactValue;
 
 /*! \brief Serialization function for an Object.
  *
@@ -45,6 +50,98 @@ void serialize(const Object& obj, int indentation, EscapeOStream& result);
 std::string WT_API serialize(const Array& arr, int indentation = 1);
 void serialize(const Array& arr, int indentation, EscapeOStream& result);
 
+/*! \brief Serialization function for a CompactValue.
+ *
+ * Serializes a CompactValue into a string, in the same format as
+ * serialize(const Object&, int). All unicode in the value is UTF-8
+ * encoded in the output. The indentation argument to this function is
+ * used in recursive calls and should not be set.
+ *
+ * \ingroup json
+ */
+std::string WT_API serialize(const CompactValue& value, int indentation = 1);
+void serialize(const CompactValue& value, int indentation,
+               EscapeOStream& result);
+
+/*! \brief Compact serialization function for a Value.
+ *
+ * Serializes a Value, without any whitespace, directly into a string
+ * stream. All unicode in the value is UTF-8 encoded in the output.
+ *
+ * This is considerably faster than serialize(const Object&, int),
+ * which builds an indented string through an escaping stream.
+ *
+ * \ingroup json
+ */
+WT_API void serialize(const Value& value, WStringStream& out);
+
+/*! \brief Compact serialization function for an Object.
+ *
+ * \sa serialize(const Value&, WStringStream&)
+ *
+ * \ingroup json
+ */
+WT_API void serialize(const Object& obj, WStringStream& out);
+
+/*! \brief Compact serialization function for an Array.
+ *
+ * \sa serialize(const Value&, WStringStream&)
+ *
+ * \ingroup json
+ */
+WT_API void serialize(const Array& arr, WStringStream& out);
+
+/*! \brief Compact serialization function for a CompactValue.
+ *
+ * \sa serialize(const Value&, WStringStream&)
+ *
+ * \ingroup json
+ */
+WT_API void serialize(const CompactValue& value, WStringStream& out);
+
+/*! \brief Compact serialization function for a Value.
+ *
+ * Serializes a Value, without any whitespace, to an output stream. The
+ * output is written in large blocks. This can be used to write a
+ * value directly to a resource response:
+ *
+ * \code
+ * void handleRequest(const Http::Request& request,
+ *                    Http::Response& response) override
+ * {
+ *   response.setMimeType("application/json");
+ *   Json::serialize(value_, response.out());
+ * }
+ * \endcode
+ *
+ * \ingroup json
+ */
+WT_API void serialize(const Value& value, std::ostream& out);
+
+/*! \brief Compact serialization function for an Object.
+ *
+ * \sa serialize(const Value&, std::ostream&)
+ *
+ * \ingroup json
+ */
+WT_API void serialize(const Object& obj, std::ostream& out);
+
+/*! \brief Compact serialization function for an Array.
+ *
+ * \sa serialize(const Value&, std::ostream&)
+ *
+ * \ingroup json
+ */
+WT_API void serialize(const Array& arr, std::ostream& out);
+
+/*! \brief Compact serialization function for a CompactValue.
+ *
+ * \sa serialize(const Value&, std::ostream&)
+ *
+ * \ingroup json
+ */
+WT_API void serialize(const CompactValue& value, std::ostream& out);
+
   }
 }
 
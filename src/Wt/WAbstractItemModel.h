@@ -281,6 +281,41 @@ public:
    */
   virtual DataMap itemData(const WModelIndex& index) const;
 
+  /*! \brief Returns data for a range of items, for several roles.
+   *
+   * Reads the data of the \p rows x \p columns items starting at
+   * \p topLeft (with the same parent), for each of the given \p roles,
+   * into \p result. The result is resized to <tt>rows * columns *
+   * roles.size()</tt>, and the data of the item at row <tt>topLeft.row()
+   * + r</tt> and column <tt>topLeft.column() + c</tt> for
+   * <tt>roles[k]</tt> is stored at <tt>(r * columns + c) *
+   * roles.size() + k</tt>. Passing the same \p result again avoids
+   * reallocating it.
+   *
+   * Views and delegates use this method to read all the data they
+   * need in one call. The default implementation calls data() for
+   * every item and role. You may want to reimplement this method if
+   * your model can provide the data more efficiently in bulk.
+   *
+   * \sa data(), itemDataRange(), setDataRange()
+   */
+  virtual void dataRange(const WModelIndex& topLeft, int rows, int columns,
+                         const std::vector<ItemDataRole>& roles,
+                         std::vector<cpp17::any>& result) const;
+
+  /*! \brief Returns all data for a range of items.
+   *
+   * Reads the itemData() of the \p rows x \p columns items starting
+   * at \p topLeft into \p result, row by row. The result is resized
+   * to <tt>rows * columns</tt>.
+   *
+   * The default implementation calls itemData() for each item.
+   *
+   * \sa itemData(), dataRange()
+   */
+  virtual void itemDataRange(const WModelIndex& topLeft, int rows,
+                             int columns, std::vector<DataMap>& result) const;
+
   /*! \brief Returns the row or column header data.
    *
    * When \p orientation is \link Wt::Orientation::Horizontal
@@ -447,6 +482,25 @@ public:
    */
   virtual bool setItemData(const WModelIndex& index, const DataMap& values);
 
+  /*! \brief Sets data for a range of items.
+   *
+   * Sets the data for the given \p role of the \p rows x \p columns
+   * items starting at \p topLeft, from \p values, which holds the
+   * values row by row and must contain <tt>rows * columns</tt> values.
+   *
+   * Returns \c true if the data of all items was set successfully.
+   *
+   * The default implementation calls setData() for every item, and
+   * thus emits dataChanged() for every item. You may want to
+   * reimplement this method to set the data in bulk and emit
+   * dataChanged() once for the whole range.
+   *
+   * \sa setData(), dataRange()
+   */
+  virtual bool setDataRange(const WModelIndex& topLeft, int rows, int columns,
+                            const std::vector<cpp17::any>& values,
+                            ItemDataRole role = ItemDataRole::Edit);
+
   /*! \brief Sets header data for a column or row.
    *
    * Returns \c true if the operation was successful.
@@ -0,0 +1,351 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WCOLUMNAR_TABLE_MODEL_H_
+#define WCOLUMNAR_TABLE_MODEL_H_
+
+#include <Wt/WAbstractTableModel.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Wt {
+
+class WDateTime;
+
+/*! \class WColumnarTableModel Wt/WColumnarTableModel.h Wt/WColumnarTableModel.h
+ *  \brief A table model that stores its data per column, in typed arrays.
+ *
+ * Unlike WStandardItemModel, which keeps a WStandardItem with a map
+ * of role data for every cell, this model keeps the values of each
+ * column in a single contiguous array of the column's type:
+ * ColumnType::Int64 (<tt>long long</tt>), ColumnType::Double
+ * (<tt>double</tt>), ColumnType::String (WString, stored as an index
+ * into a per-column pool of distinct strings) or ColumnType::DateTime
+ * (WDateTime). This makes the model suitable for large data sets,
+ * both in memory use and in the speed of sort(), filtering (see
+ * rowsInRange() and rowsMatching()) and aggregate().
+ *
+ * Every cell may also be null, in which case data() returns an empty
+ * value. Rows added with insertRows() are null until set.
+ *
+ * Cells can only hold display (and edit) data. Data for other roles,
+ * like ItemDataRole::StyleClass or ItemDataRole::Decoration, can be
+ * set for an entire column using setColumnData().
+ *
+ * The model can be used directly with WTableView and the chart
+ * classes, which read numeric values through Wt::asNumber(). A
+ * ColumnType::DateTime value is converted to a number of seconds
+ * since the epoch.
+ *
+ * Usage example:
+ * \if cpp
+ * \code
+ * auto model = std::make_shared<Wt::WColumnarTableModel>();
+ * int name = model->addColumn(Wt::WColumnarTableModel::ColumnType::String, "Name");
+ * int amount = model->addColumn(Wt::WColumnarTableModel::ColumnType::Double, "Amount");
+ *
+ * model->insertRows(0, 2);
+ * model->setString(0, name, "apples");
+ * model->setDouble(0, amount, 2.5);
+ * model->setString(1, name, "pears");
+ * model->setDouble(1, amount, 1.25);
+ *
+ * double total = model->aggregate(amount).sum;
+ * \endcode
+ * \endif
+ *
+ * \ingroup modelview
+ */
+class WT_API WColumnarTableModel : public WAbstractTableModel
+{
+public:
+  /*! \brief The type of a column.
+   */
+  enum class ColumnType {
+    Int64,    //!< 64-bit integer values (<tt>long long</tt>)
+    Double,   //!< Floating point values
+    String,   //!< String values (WString)
+    DateTime  //!< Date time values (WDateTime)
+  };
+
+  /*! \brief Aggregate statistics of numeric values.
+   *
+   * \sa aggregate()
+   */
+  struct WT_API Aggregate {
+    /*! \brief The number of non-null values.
+     */
+    int count;
+
+    /*! \brief The sum of the values.
+     */
+    double sum;
+
+    /*! \brief The smallest value.
+     *
+     * This is NaN if there are no values.
+     */
+    double minimum;
+
+    /*! \brief The largest value.
+     *
+     * This is NaN if there are no values.
+     */
+    double maximum;
+
+    /*! \brief Returns the mean value.
+     *
+     * This is NaN if there are no values.
+     */
+    double mean() const;
+
+    Aggregate();
+  };
+
+  /*! \brief Creates a new model without columns.
+   *
+   * The model has \p rows rows, which will be null in every column
+   * added later.
+   */
+  explicit WColumnarTableModel(int rows = 0);
+
+  /*! \brief Destructor.
+   */
+  virtual ~WColumnarTableModel();
+
+  /*! \brief Adds a column.
+   *
+   * Adds a column of the given \p type, with the given \p header as
+   * header data. Its values are all null.
+   *
+   * Returns the index of the new column.
+   */
+  int addColumn(ColumnType type, const WString& header = WString());
+
+  /*! \brief Returns the type of a column.
+   */
+  ColumnType columnType(int column) const;
+
+  /*! \brief Reserves storage for a number of rows.
+   *
+   * This avoids reallocations while inserting rows up to the given
+   * number of rows.
+   */
+  void reserve(int rows);
+
+  /*! \brief Sets an integer value.
+   *
+   * The column must be of type ColumnType::Int64.
+   */
+  void setInt64(int row, int column, long long value);
+
+  /*! \brief Sets a floating point value.
+   *
+   * The column must be of type ColumnType::Double.
+   */
+  void setDouble(int row, int column, double value);
+
+  /*! \brief Sets a string value.
+   *
+   * The column must be of type ColumnType::String.
+   *
+   * Equal strings in a column are stored only once: literal strings
+   * with the same value, and localized strings with the same key and
+   * arguments. A value that is no longer used by any row is released.
+   */
+  void setString(int row, int column, const WString& value);
+
+  /*! \brief Sets a date time value.
+   *
+   * The column must be of type ColumnType::DateTime.
+   */
+  void setDateTime(int row, int column, const WDateTime& value);
+
+  /*! \brief Sets a value to null.
+   */
+  void setNull(int row, int column);
+
+  /*! \brief Returns whether a value is null.
+   */
+  bool isNull(int row, int column) const;
+
+  /*! \brief Returns an integer value.
+   *
+   * The column must be of type ColumnType::Int64. A null value is
+   * returned as 0.
+   */
+  long long int64Value(int row, int column) const;
+
+  /*! \brief Returns a floating point value.
+   *
+   * The column must be of type ColumnType::Double. A null value is
+   * returned as 0.
+   */
+  double doubleValue(int row, int column) const;
+
+  /*! \brief Returns a string value.
+   *
+   * The column must be of type ColumnType::String. A null value is
+   * returned as an empty string.
+   */
+  const WString& stringValue(int row, int column) const;
+
+  /*! \brief Returns a date time value.
+   *
+   * The column must be of type ColumnType::DateTime. A null value is
+   * returned as a null date time.
+   */
+  const WDateTime& dateTimeValue(int row, int column) const;
+
+  /*! \brief Returns a value as a number.
+   *
+   * Returns the value like Wt::asNumber() would convert it, or NaN
+   * for a null value.
+   */
+  double numericValue(int row, int column) const;
+
+  /*! \brief Sets data for a role, for all cells of a column.
+   *
+   * This sets the data returned by data() for all cells of a column,
+   * for a role other than ItemDataRole::Display or
+   * ItemDataRole::Edit. Setting an empty value removes it.
+   */
+  void setColumnData(int column, ItemDataRole role, const cpp17::any& value);
+
+  /*! \brief Returns data for a role, for all cells of a column.
+   *
+   * \sa setColumnData()
+   */
+  cpp17::any columnData(int column, ItemDataRole role) const;
+
+  /*! \brief Sets the flags for all cells of a column.
+   *
+   * The default flags are ItemFlag::Selectable.
+   */
+  void setColumnFlags(int column, WFlags<ItemFlag> flags);
+
+  /*! \brief Returns the rows with a value in a range.
+   *
+   * Returns, in increasing order, the rows of which the numericValue()
+   * lies between \p minimum and \p maximum (inclusive).
+   */
+  std::vector<int> rowsInRange(int column, double minimum, double maximum)
+    const;
+
+  /*! \brief Returns the rows with a matching value.
+   *
+   * Returns, in increasing order, the (non-null) rows of which the
+   * value, converted to a string, matches the \p predicate. For a
+   * column of type ColumnType::String, the predicate is evaluated
+   * only once for every distinct value.
+   */
+  std::vector<int> rowsMatching
+    (int column, const std::function<bool (const WString&)>& predicate) const;
+
+  /*! \brief Computes aggregate statistics of a column.
+   *
+   * The statistics are computed over the numericValue() of the
+   * non-null values. For a column of type ColumnType::String, only
+   * the count is meaningful.
+   */
+  Aggregate aggregate(int column) const;
+
+  /*! \brief Computes aggregate statistics of some rows of a column.
+   *
+   * \sa aggregate(int) const, rowsInRange(), rowsMatching()
+   */
+  Aggregate aggregate(int column, const std::vector<int>& rows) const;
+
+  virtual int columnCount(const WModelIndex& parent = WModelIndex())
+    const override;
+  virtual int rowCount(const WModelIndex& parent = WModelIndex())
+    const override;
+
+  virtual WFlags<ItemFlag> flags(const WModelIndex& index) const override;
+
+  using WAbstractTableModel::data;
+
+  virtual cpp17::any data(const WModelIndex& index,
+                          ItemDataRole role = ItemDataRole::Display)
+    const override;
+
+  /*! \brief Returns data for a range of items, for several roles.
+   *
+   * Reads the values directly from the column arrays.
+   */
+  virtual void dataRange(const WModelIndex& topLeft, int rows, int columns,
+                         const std::vector<ItemDataRole>& roles,
+                         std::vector<cpp17::any>& result) const override;
+
+  using WAbstractTableModel::setData;
+
+  /*! \brief Sets data at the given model index.
+   *
+   * For ItemDataRole::Display or ItemDataRole::Edit, the \p value is
+   * converted to the type of the column, and an empty value sets the
+   * cell to null. Data for other roles cannot be set for a single
+   * cell, see setColumnData().
+   */
+  virtual bool setData(const WModelIndex& index, const cpp17::any& value,
+                       ItemDataRole role = ItemDataRole::Edit) override;
+
+  /*! \brief Sets data for a range of items.
+   *
+   * Converts the values like setData(), and emits dataChanged() only
+   * once, for the whole range.
+   */
+  virtual bool setDataRange(const WModelIndex& topLeft, int rows, int columns,
+                            const std::vector<cpp17::any>& values,
+                            ItemDataRole role = ItemDataRole::Edit) override;
+
+  virtual cpp17::any headerData(int section,
+                                Orientation orientation = Orientation::Horizontal,
+                                ItemDataRole role = ItemDataRole::Display)
+    const override;
+
+  using WAbstractTableModel::setHeaderData;
+
+  virtual bool setHeaderData(int section, Orientation orientation,
+                             const cpp17::any& value,
+                             ItemDataRole role = ItemDataRole::Edit)
+    override;
+
+  virtual bool insertRows(int row, int count,
+                          const WModelIndex& parent = WModelIndex()) override;
+
+  virtual bool removeRows(int row, int count,
+                          const WModelIndex& parent = WModelIndex()) override;
+
+  virtual bool removeColumns(int column, int count,
+                             const WModelIndex& parent = WModelIndex())
+    override;
+
+  /*! \brief Sorts the model according to a particular column.
+   *
+   * The rows are reordered, using a stable sort on the typed values
+   * of the \p column. In ascending order, null values sort before all
+   * other values.
+   */
+  virtual void sort(int column,
+                    SortOrder order = SortOrder::Ascending) override;
+
+private:
+  struct Column;
+
+  std::vector<std::unique_ptr<Column> > columns_;
+  int rowCount_;
+  bool batchUpdate_;
+
+  Column& column(int column, ColumnType type);
+  const Column& column(int column, ColumnType type) const;
+  void changed(int row, int column);
+};
+
+}
+
+#endif // WCOLUMNAR_TABLE_MODEL_H_
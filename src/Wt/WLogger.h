@@ -17,10 +17,12 @@
 #include <Wt/Dbo/StringStream.h>
 #endif // WT_DBO_LOGGER
 
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #if !defined(WT_DBO_LOGGER) || DOXYGEN_ONLY
@@ -258,6 +260,12 @@ public:
    */
   bool logging(const std::string& type, const std::string& scope) const;
 
+  /*! \brief Returns whether messages of a given type and scope are logged.
+   *
+   * \sa configure()
+   */
+  bool logging(const char *type, const char *scope) const;
+
   /*! \brief Enabled the logger to take locks when logging.
    *
    * This enables log entries to be consistently placed on their own
@@ -278,12 +286,132 @@ public:
    */
   bool useLock() const { return useLock_; }
 
+  /*! \brief Output format.
+   *
+   * \sa setFormat()
+   */
+  enum class Format {
+    Text, //!< Fields separated by spaces, string fields quoted
+    Json  //!< A JSON object per line, with a member per field
+  };
+
+  /*! \brief Sets the output format.
+   *
+   * The default format, Format::Text, writes the fields of an entry
+   * separated by spaces. Fields that are strings are quoted.
+   *
+   * With Format::Json, each entry is written as a JSON object, on a
+   * single line. The object has a member for each field that has a
+   * value, named after the field:
+   * - a field with only numbers is written as a number, other fields as
+   *   a string;
+   * - a field value enclosed in brackets, like "[info]", is written
+   *   without them, except for the message (the last field);
+   * - the time stamp is written in ISO 8601 format, in UTC.
+   *
+   * A message that starts with its scope, as written by the LOG_INFO()
+   * family of macros, gets the scope as a separate "scope" member
+   * instead. The application log of %Wt then looks like:
+   *
+   * \code
+   * {"timestamp":"2026-03-01T10:42:17.081Z","pid":4174,"session":"/ nWvQkRfrn5xV","level":"info","message":"Session created","scope":"Wt"}
+   * \endcode
+   *
+   * \note The application log format can be set in the configuration
+   *       file, with the \c format attribute of &lt;log-config&gt;.
+   */
+  void setFormat(Format format);
+
+  /*! \brief Returns the output format.
+   *
+   * \sa setFormat()
+   */
+  Format format() const { return format_; }
+
+  /*! \brief Policy when the queue of an asynchronous logger is full.
+   *
+   * \sa setAsync()
+   */
+  enum class OverflowPolicy {
+    Block, //!< Wait until the writer thread has made room
+    Drop   //!< Discard the entry, see droppedCount()
+  };
+
+  /*! \brief Writes entries from a background thread.
+   *
+   * By default, an entry is written to the stream by the thread that
+   * logs it. A slow stream (or a burst of entries) then stalls that
+   * thread.
+   *
+   * When \p enabled, formatted entries are instead put in a bounded
+   * queue with room for (at least) \p queueSize entries, from which a
+   * dedicated thread writes them to the stream. Putting an entry in the
+   * queue does not take a lock. When the queue is full, the \p policy
+   * decides whether the logging thread waits, or the entry is dropped.
+   *
+   * The writer thread does not flush the stream after each entry, but
+   * at least every flushInterval(), and on flush().
+   *
+   * Disabling asynchronous mode writes the queued entries and stops
+   * the writer thread. Like configure() and setStream(), this should
+   * not be called while other threads are logging.
+   *
+   * Asynchronous mode requires a multi-threaded build of %Wt.
+   *
+   * \sa setFlushInterval(), flush()
+   */
+  void setAsync(bool enabled, std::size_t queueSize = 8192,
+                OverflowPolicy policy = OverflowPolicy::Block);
+
+  /*! \brief Returns whether entries are written from a background thread.
+   *
+   * \sa setAsync()
+   */
+  bool isAsync() const { return async_ != nullptr; }
+
+  /*! \brief Sets the flush interval for asynchronous mode.
+   *
+   * The default interval is 250 ms.
+   *
+   * \sa setAsync()
+   */
+  void setFlushInterval(std::chrono::milliseconds interval);
+
+  /*! \brief Returns the flush interval for asynchronous mode.
+   *
+   * \sa setFlushInterval()
+   */
+  std::chrono::milliseconds flushInterval() const { return flushInterval_; }
+
+  /*! \brief Returns the number of dropped entries.
+   *
+   * Returns the number of entries that were dropped because the queue
+   * was full, since asynchronous mode was enabled with the
+   * OverflowPolicy::Drop policy.
+   *
+   * \sa setAsync()
+   */
+  unsigned long long droppedCount() const;
+
+  /*! \brief Writes all pending entries.
+   *
+   * In asynchronous mode, this waits until the entries that were
+   * logged before have been written, and the stream has been flushed.
+   * Otherwise, this flushes the stream.
+   */
+  void flush();
+
 private:
+  struct AsyncWriter;
+
   std::ostream* o_;
   bool ownStream_;
   bool useLock_;
+  Format format_;
   mutable std::mutex addLineLock_;
   std::vector<Field> fields_;
+  std::unique_ptr<AsyncWriter> async_;
+  std::chrono::milliseconds flushInterval_;
 
   struct Rule {
     bool include;
@@ -293,6 +421,12 @@ private:
 
   std::vector<Rule> rules_;
 
+  // rules_, compiled for quick logging() checks
+  struct CompiledRules;
+  std::unique_ptr<CompiledRules> compiledRules_;
+
+  void compileRules();
+
   void addLine(const std::string& type, const std::string& scope,
                const WStringStream& s) const;
 
@@ -377,7 +511,7 @@ public:
     if (impl_) {
       char buf[100];
       std::sprintf(buf, "%p", t);
-      impl_->line_ << buf;
+      impl_->write(buf, true);
     }
     return *this;
   }
@@ -390,7 +524,7 @@ public:
     if (impl_)
     {
       using std::to_string;
-      impl_->line_ << to_string(t);
+      impl_->write(to_string(t), !std::is_integral<T>::value);
     }
     return *this;
   }
@@ -404,11 +538,17 @@ private:
     int field_;
     bool fieldStarted_;
 
+    // Format::Json: the current field, and whether it is not a number
+    bool json_;
+    std::string value_;
+    bool text_;
+
     Impl(const WLogger& logger, const std::string& type);
     Impl(const WLogSink& customLogger, const std::string& type);
 
     bool quote() const;
 
+    void write(const std::string& s, bool text);
     void finish();
     void finishField();
     void nextField();
@@ -440,6 +580,8 @@ WT_LOGGER_API extern WLogger& logInstance();
 #ifdef WT_BUILDING
 WT_LOGGER_API extern bool logging(const std::string &type,
                                   const std::string &scope) noexcept;
+WT_LOGGER_API extern bool logging(const char *type,
+                                  const char *scope) noexcept;
 #endif // WT_BUILDING
 
 #ifdef DOXYGEN_ONLY
@@ -141,6 +141,15 @@ public:
    *
    * The message file that is used depends on the application's locale.
    *
+   * A message file is read only once per process: all sessions
+   * that use it share the same (read-only) messages. When the file
+   * is modified, it is read again the next time a session loads it
+   * (e.g. when a new session starts), after which all sessions
+   * use the new version.
+   *
+   * When \p loadInMemory is \c false, a session releases its
+   * reference to the messages while it is not handling a request.
+   *
    * \sa WApplication::locale()
    */
   void use(const std::string& path, bool loadInMemory = true);
@@ -7,10 +7,13 @@
 #ifndef WMESSAGE_RESOURCES_
 #define WMESSAGE_RESOURCES_
 
+#include <atomic>
+#include <memory>
 #include <string>
 #include <vector>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <Wt/WFlags.h>
 #include <Wt/WMessageResourceBundle.h>
 #include <Wt/WDllDefs.h>
@@ -44,34 +47,59 @@ public:
   std::set<std::string> keys(const WLocale& locale) const;
 
 private:
-  typedef std::map<std::string, std::vector<std::string> > KeyValuesMap;
+  class PluralExpression;
+  class ResourceCache;
 
+  typedef std::unordered_map<std::string, std::vector<std::string> >
+    KeyValuesMap;
+
+  /*
+   * The messages of one file. A resource is not modified once it has
+   * been read, and is shared by all sessions through the ResourceCache.
+   */
   struct Resource {
     KeyValuesMap map_;
     std::string pluralExpression_;
+    std::shared_ptr<const PluralExpression> plural_;
     unsigned pluralCount_;
+
+    Resource();
   };
 
-  typedef std::map<std::string, Resource> ResourceMap;
+  typedef std::unordered_map<std::string, std::shared_ptr<const Resource> >
+    ResourceMap;
 
   bool loadInMemory_;
   std::string path_;
   const char *builtin_;
 #ifdef WT_THREADED
-  std::mutex resourceMutex_;
+  mutable std::recursive_mutex resourceMutex_;
 #endif
-  mutable ResourceMap resources_;
+  mutable std::set<std::string> loading_;
+
+  /*
+   * Loaded resources, per locale. The map is replaced (copy on write,
+   * while holding resourceMutex_) and read without locking through
+   * std::atomic_load().
+   */
+  mutable std::shared_ptr<const ResourceMap> resources_;
 
-  void load(const WLocale& locale) const;
+  // ResourceCache generation of resources_, to pick up changed files
+  mutable std::atomic<unsigned> generation_;
+
+  std::shared_ptr<const Resource> resource(const std::string& locale) const;
+  std::shared_ptr<const Resource> load(const std::string& locale) const;
+  void reset(unsigned generation) const;
   LocalizedString resolve(const std::string& locale, const std::string& key) const;
   LocalizedString resolvePlural(const std::string& locale, const std::string& key, ::uint64_t amount) const;
-  bool readResourceFile(const std::string& locale, Resource& resource) const;
-  bool readResourceStream(std::istream &s, Resource& resource,
-                          const std::string &fileName) const;
-
-  std::string findCase(const std::vector<std::string> &cases,
-                       std::string pluralExpression,
-                       ::uint64_t amount) const;
+  std::shared_ptr<const Resource>
+    readResourceFile(const std::string& locale) const;
+  static bool readResourceStream(std::istream &s, Resource& resource,
+                                 const std::string &fileName);
+
+  static std::string findCase(const std::vector<std::string> &cases,
+                              const Resource& resource,
+                              ::uint64_t amount);
 };
 
 }
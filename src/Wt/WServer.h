@@ -635,7 +635,8 @@ public:
   WT_API WLogEntry log(const std::string& type) const;
 
   WT_API void initLogger(const std::string& logFile,
-                         const std::string& logConfig);
+                         const std::string& logConfig,
+                         WLogger::Format format = WLogger::Format::Text);
 
   /*! \brief Reflects whether the current process is a dedicated session process
    *
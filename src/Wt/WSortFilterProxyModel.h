@@ -219,6 +219,28 @@ public:
    */
   bool dynamicSortFilter() const { return dynamic_; }
 
+#ifndef WT_TARGET_JAVA
+  /*! \brief Sets the number of threads used to sort and filter.
+   *
+   * When the proxy sorts or filters on cached values (see
+   * cacheSortFilterValues()), a large model (from 10000 rows on) may be
+   * sorted and filtered with up to \p count threads, including the
+   * calling thread. The threads used by all proxy models together are
+   * limited to the hardware concurrency; when none are available, the
+   * calling thread does the work alone.
+   *
+   * The default is 1: no additional threads are used. More than one
+   * thread requires a multi-threaded build of %Wt.
+   */
+  void setSortFilterThreads(int count);
+
+  /*! \brief Returns the number of threads used to sort and filter.
+   *
+   * \sa setSortFilterThreads()
+   */
+  int sortFilterThreads() const { return threads_; }
+#endif // WT_TARGET_JAVA
+
   /*! \brief Invalidates the current filter.
    *
    * This refilters and resorts the model, and is useful only if you
@@ -300,6 +322,25 @@ protected:
     const;
 #endif
 
+#ifndef WT_TARGET_JAVA
+  /*! \brief Returns whether sorting and filtering may use cached values.
+   *
+   * When this returns \c true, the proxy fetches the sortRole() data
+   * of the sort column and the filterRole() data of filterKeyColumn()
+   * only once per source row when it (re)builds its mapping, and
+   * sorts and filters these values directly, possibly in several
+   * threads (see setSortFilterThreads()). Otherwise, lessThan() is called for every
+   * comparison and filterAcceptRow() for every row.
+   *
+   * The default implementation returns \c true for a
+   * WSortFilterProxyModel, but \c false for a subclass, since it may
+   * reimplement lessThan() or filterAcceptRow(). You may reimplement
+   * this method to return \c true in a subclass that reimplements
+   * neither.
+   */
+  virtual bool cacheSortFilterValues() const;
+#endif
+
 #ifdef WT_TARGET_JAVA
   /*! \brief Compares two indexes.
    *
@@ -350,6 +391,9 @@ private:
   ItemDataRole sortRole_;
   SortOrder sortOrder_;
   bool dynamic_, inserting_;
+#ifndef WT_TARGET_JAVA
+  int threads_;
+#endif
 
   std::vector<Wt::Signals::connection> modelConnections_;
   mutable ItemMap mappedIndexes_;
@@ -386,8 +430,17 @@ private:
   void resetMappings();
   void updateItem(Item *item) const;
   void rebuildSourceRowMap(Item *item) const;
+  void updateSourceRowMap(Item *item, int from) const;
+  bool isInOrder(Item *item, int proxyRow) const;
+  void insertMapped(Item *item, const WModelIndex& proxyParent, int proxyRow,
+                    const std::vector<int>& sourceRows) const;
+  void removeMapped(Item *item, const WModelIndex& proxyParent,
+                    int firstProxyRow, int lastProxyRow) const;
+#ifndef WT_TARGET_JAVA
+  void filterCached(Item *item, int sourceRowCount) const;
+  void sortCached(Item *item) const;
+#endif
 
-  int mappedInsertionPoint(int sourceRow, Item *item) const;
 #ifndef WT_TARGET_JAVA
   int compare(const WModelIndex& lhs, const WModelIndex& rhs) const;
 #endif
@@ -520,6 +520,14 @@ public:
    */
   const std::string key() const;
 
+  /*! \brief Returns the number for a localized plural string.
+   *
+   * Returns -1 if the string is not a plural string.
+   *
+   * \sa trn()
+   */
+  ::int64_t pluralCount() const { return impl_ ? impl_->n_ : -1; }
+
   /*! \brief Substitutes the next positional argument with a string value.
    *
    * In the string, the \p n-th argument is referred to as using
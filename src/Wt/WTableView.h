@@ -148,6 +148,38 @@ public:
    */
   WLength preloadMargin(Side side) const;
 
+  /*! \brief Enables recycling of the rendered rows while scrolling.
+   *
+   * By default, when the view is scrolled, the rows that leave the
+   * rendered area (see setPreloadMargin()) are deleted, and for the
+   * rows that enter it new widgets are created for every cell.
+   *
+   * When row recycling is enabled, the cell widgets of rows that
+   * leave the rendered area are reused for the rows that enter it,
+   * and are only updated with the data of their new row, using
+   * WAbstractItemDelegate::update(). Rows that remain rendered are
+   * left untouched. When the view jumps to a range that does not
+   * overlap the rendered rows, all rendered cells are reused. With a
+   * WItemDelegate, an update is usually only a change of the text of
+   * a cell, which avoids creating new widgets, and pays off for large
+   * models that are scrolled quickly. Cells that are being edited are
+   * not recycled.
+   *
+   * Since recycled cells are updated, a custom item delegate must
+   * fully update a widget that is passed to
+   * WAbstractItemDelegate::update().
+   *
+   * This only applies when the view is rendered with JavaScript
+   * support. Row recycling is disabled by default.
+   */
+  void setRowRecyclingEnabled(bool enabled);
+
+  /*! \brief Returns whether rows are recycled while scrolling.
+   *
+   * \sa setRowRecyclingEnabled()
+   */
+  bool isRowRecyclingEnabled() const { return rowRecycling_; }
+
   virtual void setHidden(bool hidden,
                          const WAnimation& animation = WAnimation()) override;
 
@@ -234,6 +266,7 @@ private:
   int scrollToRow_;
   ScrollHint scrollToHint_;
   bool columnResizeConnected_;
+  bool rowRecycling_;
 
   void updateTableBackground();
 
@@ -257,6 +290,9 @@ private:
 
   void renderTable(const int firstRow, const int lastRow,
                    const int firstColumn, const int lastColumn);
+  void recycleRows(const int firstRow, const int lastRow);
+  void recycleItem(int oldRow, int row, int renderedRow, int renderedColumn);
+  void setRenderedOffset(int row);
   void addSection(const Side side);
   void removeSection(const Side side);
   int firstRow() const;
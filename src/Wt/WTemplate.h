@@ -792,7 +792,9 @@ public:
   /*! \brief Renders a template into the given result stream.
    *
    * The default implementation will parse the template, and resolve variables
-   * by calling resolveString().
+   * by calling resolveString(). The parsed form of a template text is cached
+   * (process-wide), so that a text which is rendered repeatedly, or by
+   * many templates, is parsed only once.
    *
    * You may want to reimplement this method to manage resources that are
    * needed to load content on-demand (e.g. database objects), or support
@@ -874,10 +876,19 @@ private:
   bool encodeInternalPaths_, encodeTemplateText_, changed_;
   TemplateWidgetIdMode widgetIdMode_;
 
+  struct Segment;
+  struct CompiledTemplate;
+
+  std::shared_ptr<const CompiledTemplate> compiled_;
+
   std::string encode(const std::string& text) const;
   static std::size_t parseArgs(const std::string& text,
                                std::size_t pos,
                                std::vector<WString>& result);
+  static std::shared_ptr<const CompiledTemplate>
+    compile(const std::string& text);
+  static std::shared_ptr<const CompiledTemplate>
+    compiledTemplate(const std::string& text);
   void unrenderWidget(WWidget *w, DomElement &el);
 
   EscapeOStream* plainTextNewLineEscStream_;
@@ -9,6 +9,8 @@
 
 #include <Wt/WStringStream.h>
 
+#include <cstdint>
+
 #ifndef WT_DBO_ESCAPEOSTREAM
 #define WT_ESCAPEOSTREAM_API WT_API
 #else // WT_DBO_ESCAPEOSTREAM
@@ -49,7 +51,7 @@ public:
     if (c_special_ == 0)
       stream_ << s;
     else
-      put(s, *this);
+      put(s, std::strlen(s), *this);
 
     return *this;
   }
@@ -75,12 +77,28 @@ private:
     char c;
     std::string s;
   };
-  std::vector<Entry> mixed_;
+  std::vector<Entry> mixed_;  // when mixing more than one rule set
   std::string special_;
-  const char *c_special_;
+  const Entry *entries_;      // mixed_, or a standard set
+  const char *c_special_;     // special_, or a standard set; 0 if empty
+  std::uint64_t specialMask_[4]; // bit set for each special character
+
+  // for findSpecial(): characters up to scanLow_ (if not 0) and the
+  // scanCount_ characters in scanChars_ are candidates
+  char scanChars_[8];
+  int scanCount_;
+  unsigned char scanLow_;
 
   void mixRules();
-  void put(const char *s, const EscapeOStream& rules);
+  void put(const char *s, std::size_t len, const EscapeOStream& rules);
+
+  bool isSpecial(char c) const {
+    unsigned char u = static_cast<unsigned char>(c);
+    return (specialMask_[u >> 6] >> (u & 63)) & 1;
+  }
+
+  const char *findSpecial(const char *s, const char *end) const;
+  const std::string& replacement(char c) const;
 
   void sAppend(char c);
   void sAppend(const char *s, int length);
@@ -0,0 +1,82 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_SIMD_UTILS_H_
+#define WT_SIMD_UTILS_H_
+
+#include <cstdint>
+#include <cstring>
+
+/*
+ * Helpers for scanning text for a few special characters, 16 bytes at
+ * a time using SSE2 when available, or 8 bytes at a time using plain
+ * 64-bit word operations otherwise.
+ */
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+  (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define WT_SSE2
+#  include <emmintrin.h>
+#  ifdef _MSC_VER
+#    include <intrin.h>
+#  endif
+#endif
+
+namespace Wt {
+  namespace Utils {
+
+#ifdef WT_SSE2
+inline int firstSetBit(unsigned mask)
+{
+#ifdef _MSC_VER
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return index;
+#else
+  return __builtin_ctz(mask);
+#endif
+}
+
+inline __m128i load16(const char *p)
+{
+  return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+}
+
+// bytes that are (unsigned) <= n
+inline __m128i bytesAtMost(__m128i v, unsigned char n)
+{
+  __m128i limit = _mm_set1_epi8(static_cast<char>(n));
+  return _mm_cmpeq_epi8(_mm_min_epu8(v, limit), v);
+}
+#endif // WT_SSE2
+
+const std::uint64_t WORD_ONES = 0x0101010101010101ULL;
+const std::uint64_t WORD_HIGH = 0x8080808080808080ULL;
+
+inline std::uint64_t loadWord(const char *p)
+{
+  std::uint64_t result;
+  std::memcpy(&result, p, sizeof(result));
+  return result;
+}
+
+// whether any byte of the word equals c
+inline bool hasByte(std::uint64_t word, unsigned char c)
+{
+  std::uint64_t x = word ^ (WORD_ONES * c);
+  return (x - WORD_ONES) & ~x & WORD_HIGH;
+}
+
+// whether any byte of the word is (unsigned) less than n, for n <= 128
+inline bool hasByteLess(std::uint64_t word, unsigned char n)
+{
+  return (word - WORD_ONES * n) & ~word & WORD_HIGH;
+}
+
+  }
+}
+
+#endif // WT_SIMD_UTILS_H_